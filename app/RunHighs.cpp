@@ -153,35 +153,35 @@ void reportModelStatsOrError(const HighsLogOptions& log_options,
         highsLogDev(log_options, HighsLogType::kInfo,
                     "SemiInt  : %" HIGHSINT_FORMAT "\n", num_semi_integer);
     } else {
-      highsLogUser(log_options, HighsLogType::kInfo, "%s",
-                   problem_type.c_str());
-      if (lp.model_name_.length())
-        highsLogUser(log_options, HighsLogType::kInfo, " %s",
-                     lp.model_name_.c_str());
-      highsLogUser(log_options, HighsLogType::kInfo,
-                   " has %" HIGHSINT_FORMAT " rows; %" HIGHSINT_FORMAT " cols",
-                   lp.num_row_, lp.num_col_);
+      // Assemble the one-line summary and log it with a single call
+      // rather than one call (and stdio round trip) per clause
+      std::string stats = problem_type;
+      if (lp.model_name_.length()) stats += " " + lp.model_name_;
+      stats += highsFormatToString(
+          " has %" HIGHSINT_FORMAT " rows; %" HIGHSINT_FORMAT " cols",
+          lp.num_row_, lp.num_col_);
       if (q_num_nz) {
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " matrix nonzeros", a_num_nz);
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " Hessian nonzeros", q_num_nz);
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT " matrix nonzeros",
+                                     a_num_nz);
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT " Hessian nonzeros",
+                                     q_num_nz);
       } else {
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " nonzeros", a_num_nz);
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT " nonzeros",
+                                     a_num_nz);
       }
       if (num_integer)
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " integer variables", num_integer);
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT
+                                     " integer variables",
+                                     num_integer);
       if (num_semi_continuous)
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " semi-continuous variables",
-                     num_semi_continuous);
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT
+                                     " semi-continuous variables",
+                                     num_semi_continuous);
       if (num_semi_integer)
-        highsLogUser(log_options, HighsLogType::kInfo,
-                     "; %" HIGHSINT_FORMAT " semi-integer variables",
-                     num_semi_integer);
-      highsLogUser(log_options, HighsLogType::kInfo, "\n");
+        stats += highsFormatToString("; %" HIGHSINT_FORMAT
+                                     " semi-integer variables",
+                                     num_semi_integer);
+      highsLogUser(log_options, HighsLogType::kInfo, "%s\n", stats.c_str());
     }
   }
 }
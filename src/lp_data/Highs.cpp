@@ -2845,12 +2845,12 @@ HighsStatus Highs::callSolveQp() {
   instance.A.mat.start = lp.a_matrix_.start_;
   instance.A.mat.index = lp.a_matrix_.index_;
   instance.A.mat.value = lp.a_matrix_.value_;
-  instance.c.value = lp.col_cost_;
+  instance.c.value.assign(lp.col_cost_.begin(), lp.col_cost_.end());
   instance.offset = lp.offset_;
-  instance.con_lo = lp.row_lower_;
-  instance.con_up = lp.row_upper_;
-  instance.var_lo = lp.col_lower_;
-  instance.var_up = lp.col_upper_;
+  instance.con_lo.assign(lp.row_lower_.begin(), lp.row_lower_.end());
+  instance.con_up.assign(lp.row_upper_.begin(), lp.row_upper_.end());
+  instance.var_lo.assign(lp.col_lower_.begin(), lp.col_lower_.end());
+  instance.var_up.assign(lp.col_upper_.begin(), lp.col_upper_.end());
   instance.Q.mat.num_col = lp.num_col_;
   instance.Q.mat.num_row = lp.num_col_;
   triangularToSquareHessian(hessian, instance.Q.mat.start, instance.Q.mat.index,
@@ -2875,6 +2875,7 @@ HighsStatus Highs::callSolveQp() {
   Runtime runtime(instance, timer_);
 
   runtime.settings.reportingfequency = 1000;
+  runtime.statistics.detailed = true;
   runtime.endofiterationevent.subscribe([this](Runtime& rt) {
     int rep = rt.statistics.iteration.size() - 1;
 
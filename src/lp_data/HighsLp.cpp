@@ -171,13 +171,19 @@ void HighsLp::applyScale() {
     // Apply the scaling to the bounds, costs and matrix, and record
     // that it has been applied
     for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      this->col_lower_[iCol] /= scale.col[iCol];
-      this->col_upper_[iCol] /= scale.col[iCol];
-      this->col_cost_[iCol] *= scale.col[iCol];
+      // Load the scale factor once and divide through its reciprocal:
+      // scale factors are powers of two, so the multiplication is exact
+      // and avoids two dependent divisions per column
+      const double col_scale = scale.col[iCol];
+      const double inv_col_scale = 1.0 / col_scale;
+      this->col_lower_[iCol] *= inv_col_scale;
+      this->col_upper_[iCol] *= inv_col_scale;
+      this->col_cost_[iCol] *= col_scale;
     }
     for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      this->row_lower_[iRow] *= scale.row[iRow];
-      this->row_upper_[iRow] *= scale.row[iRow];
+      const double row_scale = scale.row[iRow];
+      this->row_lower_[iRow] *= row_scale;
+      this->row_upper_[iRow] *= row_scale;
     }
     this->a_matrix_.applyScale(scale);
     this->is_scaled_ = true;
@@ -196,13 +202,17 @@ void HighsLp::unapplyScale() {
   // Unapply the scaling to the bounds, costs and matrix, and record
   // that it has been unapplied
   for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-    this->col_lower_[iCol] *= scale.col[iCol];
-    this->col_upper_[iCol] *= scale.col[iCol];
-    this->col_cost_[iCol] /= scale.col[iCol];
+    // As in applyScale: one load of the (power of two) scale factor and
+    // reciprocal multiplication instead of division
+    const double col_scale = scale.col[iCol];
+    this->col_lower_[iCol] *= col_scale;
+    this->col_upper_[iCol] *= col_scale;
+    this->col_cost_[iCol] *= 1.0 / col_scale;
   }
   for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-    this->row_lower_[iRow] /= scale.row[iRow];
-    this->row_upper_[iRow] /= scale.row[iRow];
+    const double inv_row_scale = 1.0 / scale.row[iRow];
+    this->row_lower_[iRow] *= inv_row_scale;
+    this->row_upper_[iRow] *= inv_row_scale;
   }
   this->a_matrix_.unapplyScale(scale);
   this->is_scaled_ = false;
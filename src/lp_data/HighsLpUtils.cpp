@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include "HConfig.h"
 #include "io/Filereader.h"
@@ -25,11 +26,17 @@
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsSolution.h"
 #include "lp_data/HighsStatus.h"
+#include "parallel/HighsParallel.h"
+#include "util/HighsBitUtils.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
 #include "util/HighsTimer.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 using std::fabs;
 using std::max;
 using std::min;
@@ -93,14 +100,10 @@ HighsStatus assessLp(HighsLp& lp, const HighsOptions& options) {
   HighsInt lp_num_nz = lp.a_matrix_.start_[lp.num_col_];
   // If entries have been removed from the matrix, resize the index
   // and value vectors to prevent bug in presolve
-  if ((HighsInt)lp.a_matrix_.index_.size() > lp_num_nz)
-    lp.a_matrix_.index_.resize(lp_num_nz);
-  if ((HighsInt)lp.a_matrix_.value_.size() > lp_num_nz)
-    lp.a_matrix_.value_.resize(lp_num_nz);
-  if ((HighsInt)lp.a_matrix_.index_.size() > lp_num_nz)
+  if ((HighsInt)lp.a_matrix_.index_.size() > lp_num_nz) {
     lp.a_matrix_.index_.resize(lp_num_nz);
-  if ((HighsInt)lp.a_matrix_.value_.size() > lp_num_nz)
     lp.a_matrix_.value_.resize(lp_num_nz);
+  }
 
   //  if (return_status == HighsStatus::kError)
   //    return_status = HighsStatus::kError;
@@ -277,56 +280,35 @@ bool lpDimensionsOk(std::string message, const HighsLp& lp,
   return ok;
 }
 
-HighsStatus assessCosts(const HighsOptions& options, const HighsInt ml_col_os,
-                        const HighsIndexCollection& index_collection,
-                        vector<double>& cost, const double infinite_cost) {
-  HighsStatus return_status = HighsStatus::kOk;
-  assert(ok(index_collection));
-  HighsInt from_k;
-  HighsInt to_k;
-  limits(index_collection, from_k, to_k);
-  if (from_k > to_k) return return_status;
+// Kind of index collection driving assessCosts/assessBounds. The
+// per-entry loops below are templated on it so the interval/set/mask
+// dispatch is resolved at compile time and each instantiation runs as a
+// tight loop without per-iteration type tests.
+enum class IndexKind { kInterval, kSet, kMask };
 
-  return_status = HighsStatus::kOk;
+template <IndexKind Kind>
+static HighsStatus assessCostsKind(
+    const HighsOptions& options, const HighsInt ml_col_os,
+    const HighsIndexCollection& index_collection, const vector<double>& cost,
+    const double infinite_cost, const HighsInt from_k, const HighsInt to_k) {
   bool error_found = false;
-  // Work through the data to be assessed.
-  //
-  // Loop is k \in [from_k...to_k) covering the entries in the
-  // interval, set or mask to be considered.
-  //
-  // For an interval or mask, these values of k are the columns to be
-  // considered in a local sense, as well as the entries in the
-  // cost data to be assessed
-  //
-  // For a set, these values of k are the indices in the set, from
-  // which the columns to be considered in a local sense are
-  // drawn. The entries in the cost data to be assessed correspond
-  // to the values of k
-  //
-  // Adding the value of ml_col_os to local_col yields the value of
-  // ml_col, being the column in a global (whole-model) sense. This is
-  // necessary when assessing the costs of columns being added to a
-  // model, since they are specified using an interval
-  // [0...num_new_col) which must be offset by the current number of
-  // columns in the model.
-  //
-  HighsInt local_col;
-  HighsInt ml_col;
-  HighsInt usr_col = -1;
+  // For every kind the costs under assessment sit in the contiguous
+  // range cost[0..to_k-from_k], so the legality test is a pure
+  // reduction that runs branchlessly first; the reporting loop below,
+  // which re-applies any mask, only runs when an illegal cost exists.
+  // For a mask collection the scan may trip on a masked-out entry, in
+  // which case the reporting pass finds nothing to log
+  bool any_illegal = false;
+  for (HighsInt k = from_k; k < to_k + 1; k++)
+    any_illegal = any_illegal | (fabs(cost[k - from_k]) >= infinite_cost);
+  if (!any_illegal) return HighsStatus::kOk;
   for (HighsInt k = from_k; k < to_k + 1; k++) {
-    if (index_collection.is_interval_ || index_collection.is_mask_) {
-      local_col = k;
-    } else {
-      local_col = index_collection.set_[k];
-    }
-    if (index_collection.is_interval_) {
-      usr_col++;
-    } else {
-      usr_col = k;
-    }
-    ml_col = ml_col_os + local_col;
-    if (index_collection.is_mask_ && !index_collection.mask_[local_col])
+    const HighsInt local_col =
+        Kind == IndexKind::kSet ? index_collection.set_[k] : k;
+    const HighsInt usr_col = Kind == IndexKind::kInterval ? k - from_k : k;
+    if (Kind == IndexKind::kMask && !index_collection.mask_[local_col])
       continue;
+    const HighsInt ml_col = ml_col_os + local_col;
     double abs_cost = fabs(cost[usr_col]);
     bool legal_cost = abs_cost < infinite_cost;
     if (!legal_cost) {
@@ -338,70 +320,141 @@ HighsStatus assessCosts(const HighsOptions& options, const HighsInt ml_col_os,
                    ml_col, abs_cost, infinite_cost);
     }
   }
-  if (error_found)
-    return_status = HighsStatus::kError;
-  else
-    return_status = HighsStatus::kOk;
-
-  return return_status;
+  if (error_found) return HighsStatus::kError;
+  return HighsStatus::kOk;
 }
 
-HighsStatus assessBounds(const HighsOptions& options, const char* type,
-                         const HighsInt ml_ix_os,
-                         const HighsIndexCollection& index_collection,
-                         vector<double>& lower, vector<double>& upper,
-                         const double infinite_bound) {
-  HighsStatus return_status = HighsStatus::kOk;
+HighsStatus assessCosts(const HighsOptions& options, const HighsInt ml_col_os,
+                        const HighsIndexCollection& index_collection,
+                        vector<double>& cost, const double infinite_cost) {
   assert(ok(index_collection));
   HighsInt from_k;
   HighsInt to_k;
   limits(index_collection, from_k, to_k);
   if (from_k > to_k) return HighsStatus::kOk;
-
-  return_status = HighsStatus::kOk;
-  bool error_found = false;
-  bool warning_found = false;
   // Work through the data to be assessed.
   //
   // Loop is k \in [from_k...to_k) covering the entries in the
   // interval, set or mask to be considered.
   //
-  // For an interval or mask, these values of k are the row/column
-  // indices to be considered in a local sense, as well as the entries
-  // in the lower and upper bound data to be assessed
+  // For an interval or mask, these values of k are the columns to be
+  // considered in a local sense, as well as the entries in the
+  // cost data to be assessed
   //
   // For a set, these values of k are the indices in the set, from
-  // which the indices to be considered in a local sense are
-  // drawn. The entries in the lower and
-  // upper bound data to be assessed correspond to the values of
-  // k.
+  // which the columns to be considered in a local sense are
+  // drawn. The entries in the cost data to be assessed correspond
+  // to the values of k
   //
-  // Adding the value of ml_ix_os to local_ix yields the value of
-  // ml_ix, being the index in a global (whole-model) sense. This is
-  // necessary when assessing the bounds of rows/columns being added
-  // to a model, since they are specified using an interval
-  // [0...num_new_row/col) which must be offset by the current number
-  // of rows/columns (generically indices) in the model.
+  // Adding the value of ml_col_os to local_col yields the value of
+  // ml_col, being the column in a global (whole-model) sense. This is
+  // necessary when assessing the costs of columns being added to a
+  // model, since they are specified using an interval
+  // [0...num_new_col) which must be offset by the current number of
+  // columns in the model.
   //
+  if (index_collection.is_interval_)
+    return assessCostsKind<IndexKind::kInterval>(options, ml_col_os,
+                                                 index_collection, cost,
+                                                 infinite_cost, from_k, to_k);
+  if (index_collection.is_set_)
+    return assessCostsKind<IndexKind::kSet>(options, ml_col_os,
+                                            index_collection, cost,
+                                            infinite_cost, from_k, to_k);
+  return assessCostsKind<IndexKind::kMask>(options, ml_col_os,
+                                           index_collection, cost,
+                                           infinite_cost, from_k, to_k);
+}
+
+template <IndexKind Kind>
+static HighsStatus assessBoundsKind(
+    const HighsOptions& options, const char* type, const HighsInt ml_ix_os,
+    const HighsIndexCollection& index_collection, vector<double>& lower,
+    vector<double>& upper, const double infinite_bound, const HighsInt from_k,
+    const HighsInt to_k) {
+  bool error_found = false;
+  bool warning_found = false;
   HighsInt num_infinite_lower_bound = 0;
   HighsInt num_infinite_upper_bound = 0;
-  HighsInt local_ix;
-  HighsInt ml_ix;
-  HighsInt usr_ix = -1;
-  for (HighsInt k = from_k; k < to_k + 1; k++) {
-    if (index_collection.is_interval_ || index_collection.is_mask_) {
-      local_ix = k;
-    } else {
-      local_ix = index_collection.set_[k];
-    }
-    if (index_collection.is_interval_) {
-      usr_ix++;
-    } else {
-      usr_ix = k;
+  HighsInt scalar_from_k = from_k;
+#if defined(__AVX2__)
+  if (Kind == IndexKind::kInterval) {
+    // Vectorized interval pass, 4 bounds pairs per iteration: compare
+    // masks select the entries to rewrite to +-kHighsInf and a popcount
+    // of the mask bits maintains the counters. Inconsistent or illegal
+    // bounds are only OR-reduced into an attention mask here (with
+    // unordered predicates so NaN bounds are not silently passed); the
+    // logging runs in a cold scalar pass over the prefix when the mask
+    // fires. The remainder falls through to the scalar loop below.
+    const HighsInt count = to_k - from_k + 1;
+    double* lo = lower.data();
+    double* up = upper.data();
+    const __m256d neg_hinf = _mm256_set1_pd(-kHighsInf);
+    const __m256d pos_hinf = _mm256_set1_pd(kHighsInf);
+    const __m256d neg_bound = _mm256_set1_pd(-infinite_bound);
+    const __m256d pos_bound = _mm256_set1_pd(infinite_bound);
+    __m256d attention = _mm256_setzero_pd();
+    HighsInt i = 0;
+    for (; i + 4 <= count; i += 4) {
+      __m256d l = _mm256_loadu_pd(&lo[i]);
+      __m256d u = _mm256_loadu_pd(&up[i]);
+      __m256d l_clamp =
+          _mm256_and_pd(_mm256_cmp_pd(l, neg_hinf, _CMP_GT_OQ),
+                        _mm256_cmp_pd(l, neg_bound, _CMP_LE_OQ));
+      __m256d u_clamp =
+          _mm256_and_pd(_mm256_cmp_pd(u, pos_hinf, _CMP_LT_OQ),
+                        _mm256_cmp_pd(u, pos_bound, _CMP_GE_OQ));
+      l = _mm256_blendv_pd(l, neg_hinf, l_clamp);
+      u = _mm256_blendv_pd(u, pos_hinf, u_clamp);
+      _mm256_storeu_pd(&lo[i], l);
+      _mm256_storeu_pd(&up[i], u);
+      num_infinite_lower_bound +=
+          highsPopcount32(_mm256_movemask_pd(l_clamp));
+      num_infinite_upper_bound +=
+          highsPopcount32(_mm256_movemask_pd(u_clamp));
+      attention =
+          _mm256_or_pd(attention, _mm256_cmp_pd(l, u, _CMP_NLE_UQ));
+      attention =
+          _mm256_or_pd(attention, _mm256_cmp_pd(l, pos_bound, _CMP_NLT_UQ));
+      attention =
+          _mm256_or_pd(attention, _mm256_cmp_pd(u, neg_bound, _CMP_NGT_UQ));
+    }
+    if (_mm256_movemask_pd(attention)) {
+      for (HighsInt j = 0; j < i; j++) {
+        const HighsInt ml_ix = ml_ix_os + from_k + j;
+        if (!(lo[j] <= up[j])) {
+          // Leave inconsistent bounds to be used to deduce infeasibility
+          highsLogUser(options.log_options, HighsLogType::kWarning,
+                       "%3s  %12" HIGHSINT_FORMAT
+                       " has inconsistent bounds [%12g, %12g]\n",
+                       type, ml_ix, lo[j], up[j]);
+          warning_found = true;
+        }
+        if (!(lo[j] < infinite_bound)) {
+          highsLogUser(options.log_options, HighsLogType::kError,
+                       "%3s  %12" HIGHSINT_FORMAT
+                       " has lower bound of %12g >= %12g\n",
+                       type, ml_ix, lo[j], infinite_bound);
+          error_found = true;
+        }
+        if (!(up[j] > -infinite_bound)) {
+          highsLogUser(options.log_options, HighsLogType::kError,
+                       "%3s  %12" HIGHSINT_FORMAT
+                       " has upper bound of %12g <= %12g\n",
+                       type, ml_ix, up[j], -infinite_bound);
+          error_found = true;
+        }
+      }
     }
-    ml_ix = ml_ix_os + local_ix;
-    if (index_collection.is_mask_ && !index_collection.mask_[local_ix])
-      continue;
+    scalar_from_k = from_k + i;
+  }
+#endif
+  for (HighsInt k = scalar_from_k; k < to_k + 1; k++) {
+    const HighsInt local_ix =
+        Kind == IndexKind::kSet ? index_collection.set_[k] : k;
+    const HighsInt usr_ix = Kind == IndexKind::kInterval ? k - from_k : k;
+    if (Kind == IndexKind::kMask && !index_collection.mask_[local_ix]) continue;
+    const HighsInt ml_ix = ml_ix_os + local_ix;
 
     if (!highs_isInfinity(-lower[usr_ix])) {
       // Check whether a finite lower bound will be treated as -Infinity
@@ -461,14 +514,54 @@ HighsStatus assessBounds(const HighsOptions& options, const char* type,
                  type, num_infinite_upper_bound, infinite_bound);
   }
 
-  if (error_found)
-    return_status = HighsStatus::kError;
-  else if (warning_found)
-    return_status = HighsStatus::kWarning;
-  else
-    return_status = HighsStatus::kOk;
+  if (error_found) return HighsStatus::kError;
+  if (warning_found) return HighsStatus::kWarning;
+  return HighsStatus::kOk;
+}
 
-  return return_status;
+HighsStatus assessBounds(const HighsOptions& options, const char* type,
+                         const HighsInt ml_ix_os,
+                         const HighsIndexCollection& index_collection,
+                         vector<double>& lower, vector<double>& upper,
+                         const double infinite_bound) {
+  assert(ok(index_collection));
+  HighsInt from_k;
+  HighsInt to_k;
+  limits(index_collection, from_k, to_k);
+  if (from_k > to_k) return HighsStatus::kOk;
+  // Work through the data to be assessed.
+  //
+  // Loop is k \in [from_k...to_k) covering the entries in the
+  // interval, set or mask to be considered.
+  //
+  // For an interval or mask, these values of k are the row/column
+  // indices to be considered in a local sense, as well as the entries
+  // in the lower and upper bound data to be assessed
+  //
+  // For a set, these values of k are the indices in the set, from
+  // which the indices to be considered in a local sense are
+  // drawn. The entries in the lower and
+  // upper bound data to be assessed correspond to the values of
+  // k.
+  //
+  // Adding the value of ml_ix_os to local_ix yields the value of
+  // ml_ix, being the index in a global (whole-model) sense. This is
+  // necessary when assessing the bounds of rows/columns being added
+  // to a model, since they are specified using an interval
+  // [0...num_new_row/col) which must be offset by the current number
+  // of rows/columns (generically indices) in the model.
+  //
+  if (index_collection.is_interval_)
+    return assessBoundsKind<IndexKind::kInterval>(
+        options, type, ml_ix_os, index_collection, lower, upper, infinite_bound,
+        from_k, to_k);
+  if (index_collection.is_set_)
+    return assessBoundsKind<IndexKind::kSet>(options, type, ml_ix_os,
+                                             index_collection, lower, upper,
+                                             infinite_bound, from_k, to_k);
+  return assessBoundsKind<IndexKind::kMask>(options, type, ml_ix_os,
+                                            index_collection, lower, upper,
+                                            infinite_bound, from_k, to_k);
 }
 
 HighsStatus assessIntegrality(HighsLp& lp, const HighsOptions& options) {
@@ -638,43 +731,71 @@ bool activeModifiedUpperBounds(const HighsOptions& options, const HighsLp& lp,
   return num_active_modified_upper;
 }
 
-HighsStatus cleanBounds(const HighsOptions& options, HighsLp& lp) {
-  double max_residual = 0;
-  HighsInt num_change = 0;
-  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
-    double residual = lp.col_lower_[iCol] - lp.col_upper_[iCol];
-    if (residual > options.primal_feasibility_tolerance) {
+// Single bounds-cleaning sweep over lower[0..count) and upper[0..count),
+// shared by the column and row passes of cleanBounds. Returns true if an
+// inconsistency beyond the feasibility tolerance was found (and logged).
+// On AVX2 builds the sweep processes four bounds pairs per iteration,
+// blending in midpoints and popcounting the changed lanes; any lane
+// exceeding the tolerance (or holding a NaN) drops to the scalar loop,
+// which produces the usual error log.
+static bool cleanBoundsPass(const HighsOptions& options, const char* type,
+                            double* lower, double* upper, const HighsInt count,
+                            HighsInt& num_change, double& max_residual) {
+  const double tolerance = options.primal_feasibility_tolerance;
+  HighsInt i = 0;
+#if defined(__AVX2__)
+  const __m256d tol = _mm256_set1_pd(tolerance);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d half = _mm256_set1_pd(0.5);
+  __m256d max_res = _mm256_setzero_pd();
+  for (; i + 4 <= count; i += 4) {
+    __m256d lo = _mm256_loadu_pd(&lower[i]);
+    __m256d up = _mm256_loadu_pd(&upper[i]);
+    __m256d res = _mm256_sub_pd(lo, up);
+    if (_mm256_movemask_pd(_mm256_cmp_pd(res, tol, _CMP_NLE_UQ))) break;
+    __m256d fix = _mm256_cmp_pd(res, zero, _CMP_GT_OQ);
+    __m256d mid = _mm256_mul_pd(_mm256_add_pd(lo, up), half);
+    _mm256_storeu_pd(&lower[i], _mm256_blendv_pd(lo, mid, fix));
+    _mm256_storeu_pd(&upper[i], _mm256_blendv_pd(up, mid, fix));
+    num_change += highsPopcount32(_mm256_movemask_pd(fix));
+    max_res = _mm256_max_pd(max_res, _mm256_and_pd(res, fix));
+  }
+  __m128d res128 = _mm_max_pd(_mm256_castpd256_pd128(max_res),
+                              _mm256_extractf128_pd(max_res, 1));
+  res128 = _mm_max_sd(res128, _mm_unpackhi_pd(res128, res128));
+  max_residual = std::max(_mm_cvtsd_f64(res128), max_residual);
+#endif
+  for (; i < count; i++) {
+    double residual = lower[i] - upper[i];
+    if (residual > tolerance) {
       highsLogUser(options.log_options, HighsLogType::kError,
-                   "Column %" HIGHSINT_FORMAT
+                   "%s %" HIGHSINT_FORMAT
                    " has inconsistent bounds [%g, %g] (residual = "
                    "%g) after presolve\n",
-                   iCol, lp.col_lower_[iCol], lp.col_upper_[iCol], residual);
-      return HighsStatus::kError;
+                   type, i, lower[i], upper[i], residual);
+      return true;
     } else if (residual > 0) {
       num_change++;
       max_residual = std::max(residual, max_residual);
-      double mid = 0.5 * (lp.col_lower_[iCol] + lp.col_upper_[iCol]);
-      lp.col_lower_[iCol] = mid;
-      lp.col_upper_[iCol] = mid;
-    }
-  }
-  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-    double residual = lp.row_lower_[iRow] - lp.row_upper_[iRow];
-    if (residual > options.primal_feasibility_tolerance) {
-      highsLogUser(options.log_options, HighsLogType::kError,
-                   "Row %" HIGHSINT_FORMAT
-                   " has inconsistent bounds [%g, %g] (residual = %g) "
-                   "after presolve\n",
-                   iRow, lp.row_lower_[iRow], lp.row_upper_[iRow], residual);
-      return HighsStatus::kError;
-    } else if (residual > 0) {
-      num_change++;
-      max_residual = std::max(residual, max_residual);
-      double mid = 0.5 * (lp.row_lower_[iRow] + lp.row_upper_[iRow]);
-      lp.row_lower_[iRow] = mid;
-      lp.row_upper_[iRow] = mid;
+      double mid = 0.5 * (lower[i] + upper[i]);
+      lower[i] = mid;
+      upper[i] = mid;
     }
   }
+  return false;
+}
+
+HighsStatus cleanBounds(const HighsOptions& options, HighsLp& lp) {
+  double max_residual = 0;
+  HighsInt num_change = 0;
+  if (cleanBoundsPass(options, "Column", lp.col_lower_.data(),
+                      lp.col_upper_.data(), lp.num_col_, num_change,
+                      max_residual))
+    return HighsStatus::kError;
+  if (cleanBoundsPass(options, "Row", lp.row_lower_.data(),
+                      lp.row_upper_.data(), lp.num_row_, num_change,
+                      max_residual))
+    return HighsStatus::kError;
   if (num_change) {
     highsLogUser(options.log_options, HighsLogType::kWarning,
                  "Resolved %" HIGHSINT_FORMAT
@@ -828,12 +949,16 @@ bool equilibrationScaleMatrix(const HighsOptions& options, HighsLp& lp,
   HighsInt numCol = lp.num_col_;
   HighsInt numRow = lp.num_row_;
   HighsScale& scale = lp.scale_;
-  vector<double>& colScale = scale.col;
-  vector<double>& rowScale = scale.row;
-  vector<HighsInt>& Astart = lp.a_matrix_.start_;
-  vector<HighsInt>& Aindex = lp.a_matrix_.index_;
-  vector<double>& Avalue = lp.a_matrix_.value_;
-  vector<double>& colCost = lp.col_cost_;
+  // Raw restrict-qualified pointers: the scan and apply loops below mix
+  // reads of the structure with writes to the values and scale factors,
+  // and the no-alias guarantee lets the compiler keep factors in
+  // registers and vectorize the multiply-store loops
+  double* __restrict colScale = scale.col.data();
+  double* __restrict rowScale = scale.row.data();
+  const HighsInt* __restrict Astart = lp.a_matrix_.start_.data();
+  const HighsInt* __restrict Aindex = lp.a_matrix_.index_.data();
+  double* __restrict Avalue = lp.a_matrix_.value_.data();
+  const double* __restrict colCost = lp.col_cost_.data();
 
   HighsInt simplex_scale_strategy = use_scale_strategy;
 
@@ -916,14 +1041,13 @@ bool equilibrationScaleMatrix(const HighsOptions& options, HighsLp& lp,
   double max_col_scale = 1 / finite_infinity;
   double min_row_scale = finite_infinity;
   double max_row_scale = 1 / finite_infinity;
-  const double log2 = log(2.0);
   for (HighsInt iCol = 0; iCol < numCol; iCol++) {
-    colScale[iCol] = pow(2.0, floor(log(colScale[iCol]) / log2 + 0.5));
+    colScale[iCol] = nearestPowerOfTwo(colScale[iCol]);
     min_col_scale = min(colScale[iCol], min_col_scale);
     max_col_scale = max(colScale[iCol], max_col_scale);
   }
   for (HighsInt iRow = 0; iRow < numRow; iRow++) {
-    rowScale[iRow] = pow(2.0, floor(log(rowScale[iRow]) / log2 + 0.5));
+    rowScale[iRow] = nearestPowerOfTwo(rowScale[iRow]);
     min_row_scale = min(rowScale[iRow], min_row_scale);
     max_row_scale = max(rowScale[iRow], max_row_scale);
   }
@@ -1095,11 +1219,18 @@ bool equilibrationScaleMatrix(const HighsOptions& options, HighsLp& lp,
 
   // Possibly abandon scaling if it's not improved equlibration significantly
   if (possibly_abandon_scaling && poor_improvement) {
-    // Unscale the matrix
+    // Unscale the matrix, multiplying by reciprocals rather than
+    // dividing: the scale factors are powers of two, so the reciprocals
+    // are exact, and the row reciprocals are materialized once rather
+    // than re-divided for every nonzero
+    vector<double> invRowScale(numRow);
+    for (HighsInt iRow = 0; iRow < numRow; iRow++)
+      invRowScale[iRow] = 1.0 / rowScale[iRow];
     for (HighsInt iCol = 0; iCol < numCol; iCol++) {
+      const double inv_col_scale = 1.0 / colScale[iCol];
       for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
         HighsInt iRow = Aindex[k];
-        Avalue[k] /= (colScale[iCol] * rowScale[iRow]);
+        Avalue[k] *= (inv_col_scale * invRowScale[iRow]);
       }
     }
     if (options.highs_analysis_level)
@@ -1147,17 +1278,18 @@ bool maxValueScaleMatrix(const HighsOptions& options, HighsLp& lp,
   HighsInt numCol = lp.num_col_;
   HighsInt numRow = lp.num_row_;
   HighsScale& scale = lp.scale_;
-  vector<double>& colScale = scale.col;
-  vector<double>& rowScale = scale.row;
-  vector<HighsInt>& Astart = lp.a_matrix_.start_;
-  vector<HighsInt>& Aindex = lp.a_matrix_.index_;
-  vector<double>& Avalue = lp.a_matrix_.value_;
+  // As in equilibrationScaleMatrix: no-alias pointers so the scan and
+  // apply loops vectorize
+  double* __restrict colScale = scale.col.data();
+  double* __restrict rowScale = scale.row.data();
+  const HighsInt* __restrict Astart = lp.a_matrix_.start_.data();
+  const HighsInt* __restrict Aindex = lp.a_matrix_.index_.data();
+  double* __restrict Avalue = lp.a_matrix_.value_.data();
 
   HighsInt simplex_scale_strategy = use_scale_strategy;
 
   assert(options.simplex_scale_strategy == kSimplexScaleStrategyMaxValue015 ||
          options.simplex_scale_strategy == kSimplexScaleStrategyMaxValue0157);
-  const double log2 = log(2.0);
   const double max_allow_scale = pow(2.0, options.allowed_matrix_scale_factor);
   const double min_allow_scale = 1 / max_allow_scale;
 
@@ -1187,7 +1319,7 @@ bool maxValueScaleMatrix(const HighsOptions& options, HighsLp& lp,
       double row_scale_value = 1 / row_max_value[iRow];
       // Convert the row scale factor to the nearest power of two, and
       // ensure that it is not excessively large or small
-      row_scale_value = pow(2.0, floor(log(row_scale_value) / log2 + 0.5));
+      row_scale_value = nearestPowerOfTwo(row_scale_value);
       row_scale_value =
           min(max(min_allow_row_scale, row_scale_value), max_allow_row_scale);
       min_row_scale = min(row_scale_value, min_row_scale);
@@ -1214,7 +1346,7 @@ bool maxValueScaleMatrix(const HighsOptions& options, HighsLp& lp,
       double col_scale_value = 1 / col_max_value;
       // Convert the col scale factor to the nearest power of two, and
       // ensure that it is not excessively large or small
-      col_scale_value = pow(2.0, floor(log(col_scale_value) / log2 + 0.5));
+      col_scale_value = nearestPowerOfTwo(col_scale_value);
       col_scale_value =
           min(max(min_allow_col_scale, col_scale_value), max_allow_col_scale);
       min_col_scale = min(col_scale_value, min_col_scale);
@@ -1241,11 +1373,16 @@ bool maxValueScaleMatrix(const HighsOptions& options, HighsLp& lp,
       improvement_factor < improvement_factor_required;
 
   if (poor_improvement) {
-    // Unscale the matrix
+    // Unscale the matrix via exact power-of-two reciprocals, with the
+    // row reciprocals materialized once outside the nonzero loop
+    vector<double> invRowScale(numRow);
+    for (HighsInt iRow = 0; iRow < numRow; iRow++)
+      invRowScale[iRow] = 1.0 / rowScale[iRow];
     for (HighsInt iCol = 0; iCol < numCol; iCol++) {
+      const double inv_col_scale = 1.0 / colScale[iCol];
       for (HighsInt k = Astart[iCol]; k < Astart[iCol + 1]; k++) {
         HighsInt iRow = Aindex[k];
-        Avalue[k] /= (colScale[iCol] * rowScale[iRow]);
+        Avalue[k] *= (inv_col_scale * invRowScale[iRow]);
       }
     }
     if (options.highs_analysis_level)
@@ -1280,12 +1417,14 @@ HighsStatus applyScalingToLpCol(HighsLp& lp, const HighsInt col,
 
   lp.a_matrix_.scaleCol(col, colScale);
   lp.col_cost_[col] *= colScale;
+  // One reciprocal rather than two dependent divisions
+  const double inv_col_scale = 1.0 / colScale;
   if (colScale > 0) {
-    lp.col_lower_[col] /= colScale;
-    lp.col_upper_[col] /= colScale;
+    lp.col_lower_[col] *= inv_col_scale;
+    lp.col_upper_[col] *= inv_col_scale;
   } else {
-    const double new_upper = lp.col_lower_[col] / colScale;
-    lp.col_lower_[col] = lp.col_upper_[col] / colScale;
+    const double new_upper = lp.col_lower_[col] * inv_col_scale;
+    lp.col_lower_[col] = lp.col_upper_[col] * inv_col_scale;
     lp.col_upper_[col] = new_upper;
   }
   return HighsStatus::kOk;
@@ -1298,17 +1437,28 @@ HighsStatus applyScalingToLpRow(HighsLp& lp, const HighsInt row,
   if (!rowScale) return HighsStatus::kError;
 
   lp.a_matrix_.scaleRow(row, rowScale);
+  // One reciprocal rather than two dependent divisions
+  const double inv_row_scale = 1.0 / rowScale;
   if (rowScale > 0) {
-    lp.row_lower_[row] /= rowScale;
-    lp.row_upper_[row] /= rowScale;
+    lp.row_lower_[row] *= inv_row_scale;
+    lp.row_upper_[row] *= inv_row_scale;
   } else {
-    const double new_upper = lp.row_lower_[row] / rowScale;
-    lp.row_lower_[row] = lp.row_upper_[row] / rowScale;
+    const double new_upper = lp.row_lower_[row] * inv_row_scale;
+    lp.row_lower_[row] = lp.row_upper_[row] * inv_row_scale;
     lp.row_upper_[row] = new_upper;
   }
   return HighsStatus::kOk;
 }
 
+// Resize with capacity growth of at least a factor of two, keeping
+// repeated batched appends amortized linear: the standard guarantees
+// geometric growth for push_back but not for resize
+template <class T>
+static void resizeGeometric(std::vector<T>& v, const size_t new_size) {
+  if (v.capacity() < new_size) v.reserve(std::max(new_size, 2 * v.capacity()));
+  v.resize(new_size);
+}
+
 void appendColsToLpVectors(HighsLp& lp, const HighsInt num_new_col,
                            const vector<double>& colCost,
                            const vector<double>& colLower,
@@ -1316,19 +1466,20 @@ void appendColsToLpVectors(HighsLp& lp, const HighsInt num_new_col,
   assert(num_new_col >= 0);
   if (num_new_col == 0) return;
   HighsInt new_num_col = lp.num_col_ + num_new_col;
-  lp.col_cost_.resize(new_num_col);
-  lp.col_lower_.resize(new_num_col);
-  lp.col_upper_.resize(new_num_col);
-  bool have_names = lp.col_names_.size();
-  if (have_names) lp.col_names_.resize(new_num_col);
-  for (HighsInt new_col = 0; new_col < num_new_col; new_col++) {
-    HighsInt iCol = lp.num_col_ + new_col;
-    lp.col_cost_[iCol] = colCost[new_col];
-    lp.col_lower_[iCol] = colLower[new_col];
-    lp.col_upper_[iCol] = colUpper[new_col];
-    // Cannot guarantee to create unique names, so name is blank
-    if (have_names) lp.col_names_[iCol] = "";
-  }
+  // Append each array with one bulk copy rather than an interleaved
+  // per-column loop, so every array is written as a single contiguous
+  // stream
+  resizeGeometric(lp.col_cost_, new_num_col);
+  std::copy(colCost.begin(), colCost.begin() + num_new_col,
+            lp.col_cost_.begin() + lp.num_col_);
+  resizeGeometric(lp.col_lower_, new_num_col);
+  std::copy(colLower.begin(), colLower.begin() + num_new_col,
+            lp.col_lower_.begin() + lp.num_col_);
+  resizeGeometric(lp.col_upper_, new_num_col);
+  std::copy(colUpper.begin(), colUpper.begin() + num_new_col,
+            lp.col_upper_.begin() + lp.num_col_);
+  // Cannot guarantee to create unique names, so names are blank
+  if (lp.col_names_.size()) resizeGeometric(lp.col_names_, new_num_col);
 }
 
 void appendRowsToLpVectors(HighsLp& lp, const HighsInt num_new_row,
@@ -1337,18 +1488,14 @@ void appendRowsToLpVectors(HighsLp& lp, const HighsInt num_new_row,
   assert(num_new_row >= 0);
   if (num_new_row == 0) return;
   HighsInt new_num_row = lp.num_row_ + num_new_row;
-  lp.row_lower_.resize(new_num_row);
-  lp.row_upper_.resize(new_num_row);
-  bool have_names = lp.row_names_.size();
-  if (have_names) lp.row_names_.resize(new_num_row);
-
-  for (HighsInt new_row = 0; new_row < num_new_row; new_row++) {
-    HighsInt iRow = lp.num_row_ + new_row;
-    lp.row_lower_[iRow] = rowLower[new_row];
-    lp.row_upper_[iRow] = rowUpper[new_row];
-    // Cannot guarantee to create unique names, so name is blank
-    if (have_names) lp.row_names_[iRow] = "";
-  }
+  resizeGeometric(lp.row_lower_, new_num_row);
+  std::copy(rowLower.begin(), rowLower.begin() + num_new_row,
+            lp.row_lower_.begin() + lp.num_row_);
+  resizeGeometric(lp.row_upper_, new_num_row);
+  std::copy(rowUpper.begin(), rowUpper.begin() + num_new_row,
+            lp.row_upper_.begin() + lp.num_row_);
+  // Cannot guarantee to create unique names, so names are blank
+  if (lp.row_names_.size()) resizeGeometric(lp.row_names_, new_num_row);
 }
 
 void deleteLpCols(HighsLp& lp, const HighsIndexCollection& index_collection) {
@@ -1365,7 +1512,6 @@ void deleteColsFromLpVectors(HighsLp& lp, HighsInt& new_num_col,
   HighsInt from_k;
   HighsInt to_k;
   limits(index_collection, from_k, to_k);
-  ;
   // Initialise new_num_col in case none is removed due to from_k > to_k
   new_num_col = lp.num_col_;
   if (from_k > to_k) return;
@@ -1386,13 +1532,22 @@ void deleteColsFromLpVectors(HighsLp& lp, HighsInt& new_num_col,
     if (k == from_k) new_num_col = delete_from_col;
     if (delete_to_col >= col_dim - 1) break;
     assert(delete_to_col < col_dim);
-    for (HighsInt col = keep_from_col; col <= keep_to_col; col++) {
-      lp.col_cost_[new_num_col] = lp.col_cost_[col];
-      lp.col_lower_[new_num_col] = lp.col_lower_[col];
-      lp.col_upper_[new_num_col] = lp.col_upper_[col];
-      if (have_names) lp.col_names_[new_num_col] = lp.col_names_[col];
-      new_num_col++;
-    }
+    // Shift each kept range down with one bulk move per array rather
+    // than interleaved per-column assignments
+    const HighsInt num_keep_col = keep_to_col + 1 - keep_from_col;
+    if (num_keep_col > 0 && new_num_col != keep_from_col) {
+      std::memmove(&lp.col_cost_[new_num_col], &lp.col_cost_[keep_from_col],
+                   num_keep_col * sizeof(double));
+      std::memmove(&lp.col_lower_[new_num_col], &lp.col_lower_[keep_from_col],
+                   num_keep_col * sizeof(double));
+      std::memmove(&lp.col_upper_[new_num_col], &lp.col_upper_[keep_from_col],
+                   num_keep_col * sizeof(double));
+      if (have_names)
+        for (HighsInt col = 0; col < num_keep_col; col++)
+          lp.col_names_[new_num_col + col] =
+              std::move(lp.col_names_[keep_from_col + col]);
+    }
+    if (num_keep_col > 0) new_num_col += num_keep_col;
     if (keep_to_col >= col_dim - 1) break;
   }
   lp.col_cost_.resize(new_num_col);
@@ -1437,12 +1592,20 @@ void deleteRowsFromLpVectors(HighsLp& lp, HighsInt& new_num_row,
     }
     if (delete_to_row >= row_dim - 1) break;
     assert(delete_to_row < row_dim);
-    for (HighsInt row = keep_from_row; row <= keep_to_row; row++) {
-      lp.row_lower_[new_num_row] = lp.row_lower_[row];
-      lp.row_upper_[new_num_row] = lp.row_upper_[row];
-      if (have_names) lp.row_names_[new_num_row] = lp.row_names_[row];
-      new_num_row++;
-    }
+    // Shift each kept range down with one bulk move per array rather
+    // than interleaved per-row assignments
+    const HighsInt num_keep_row = keep_to_row + 1 - keep_from_row;
+    if (num_keep_row > 0 && new_num_row != keep_from_row) {
+      std::memmove(&lp.row_lower_[new_num_row], &lp.row_lower_[keep_from_row],
+                   num_keep_row * sizeof(double));
+      std::memmove(&lp.row_upper_[new_num_row], &lp.row_upper_[keep_from_row],
+                   num_keep_row * sizeof(double));
+      if (have_names)
+        for (HighsInt row = 0; row < num_keep_row; row++)
+          lp.row_names_[new_num_row + row] =
+              std::move(lp.row_names_[keep_from_row + row]);
+    }
+    if (num_keep_row > 0) new_num_row += num_keep_row;
     if (keep_to_row >= row_dim - 1) break;
   }
   lp.row_lower_.resize(new_num_row);
@@ -1483,6 +1646,34 @@ void deleteScale(vector<double>& scale,
   }
 }
 
+// Position of entry (row, col) in the constraint matrix, or -1 if the
+// coefficient is structurally zero. Row indices within a CSC column
+// are not kept sorted - assessMatrix only rejects duplicates - so this
+// is an equality scan; on AVX2 builds eight indices are compared per
+// step, which matters for point queries on dense columns
+static HighsInt findLpMatrixEntry(const HighsLp& lp, const HighsInt row,
+                                  const HighsInt col) {
+  const HighsInt to_el = lp.a_matrix_.start_[col + 1];
+  const HighsInt* index = lp.a_matrix_.index_.data();
+  HighsInt el = lp.a_matrix_.start_[col];
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+  const __m256i target = _mm256_set1_epi32(row);
+  for (; el + 8 <= to_el; el += 8) {
+    // Stay a cache line ahead of the scan on long columns; the hint is
+    // harmless past the end of the array
+    _mm_prefetch(reinterpret_cast<const char*>(&index[el + 16]), _MM_HINT_T0);
+    const __m256i chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&index[el]));
+    const int hits = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(chunk, target)));
+    if (hits) return el + highsCtz32(static_cast<unsigned>(hits));
+  }
+#endif
+  for (; el < to_el; el++)
+    if (index[el] == row) return el;
+  return -1;
+}
+
 void changeLpMatrixCoefficient(HighsLp& lp, const HighsInt row,
                                const HighsInt col, const double new_value,
                                const bool zero_new_value) {
@@ -1491,14 +1682,7 @@ void changeLpMatrixCoefficient(HighsLp& lp, const HighsInt row,
 
   // Determine whether the coefficient corresponds to an existing
   // nonzero
-  HighsInt change_el = -1;
-  for (HighsInt el = lp.a_matrix_.start_[col];
-       el < lp.a_matrix_.start_[col + 1]; el++) {
-    if (lp.a_matrix_.index_[el] == row) {
-      change_el = el;
-      break;
-    }
-  }
+  HighsInt change_el = findLpMatrixEntry(lp, row, col);
   if (change_el < 0) {
     // Coefficient doesn't correspond to an existing nonzero
     //
@@ -1508,21 +1692,35 @@ void changeLpMatrixCoefficient(HighsLp& lp, const HighsInt row,
     // all index and value entries forward by 1 to accommodate it
     change_el = lp.a_matrix_.start_[col + 1];
     HighsInt new_num_nz = lp.a_matrix_.start_[lp.num_col_] + 1;
-    lp.a_matrix_.index_.resize(new_num_nz);
-    lp.a_matrix_.value_.resize(new_num_nz);
+    // Grow geometrically so a sequence of single-coefficient inserts
+    // doesn't pay an exact-size reallocation each time
+    resizeGeometric(lp.a_matrix_.index_, new_num_nz);
+    resizeGeometric(lp.a_matrix_.value_, new_num_nz);
     for (HighsInt i = col + 1; i <= lp.num_col_; i++) lp.a_matrix_.start_[i]++;
-    for (HighsInt el = new_num_nz - 1; el > change_el; el--) {
-      lp.a_matrix_.index_[el] = lp.a_matrix_.index_[el - 1];
-      lp.a_matrix_.value_[el] = lp.a_matrix_.value_[el - 1];
+    // Shift the tail up with one bulk move per array rather than an
+    // element loop
+    const HighsInt num_shift = new_num_nz - 1 - change_el;
+    if (num_shift > 0) {
+      std::memmove(&lp.a_matrix_.index_[change_el + 1],
+                   &lp.a_matrix_.index_[change_el],
+                   num_shift * sizeof(HighsInt));
+      std::memmove(&lp.a_matrix_.value_[change_el + 1],
+                   &lp.a_matrix_.value_[change_el],
+                   num_shift * sizeof(double));
     }
   } else if (zero_new_value) {
-    // Coefficient zeroes an existing nonzero, so shift all index and
-    // value entries backward by 1 to eliminate it
+    // Coefficient zeroes an existing nonzero, so shift the tail of the
+    // index and value entries down to eliminate it
     HighsInt new_num_nz = lp.a_matrix_.start_[lp.num_col_] - 1;
     for (HighsInt i = col + 1; i <= lp.num_col_; i++) lp.a_matrix_.start_[i]--;
-    for (HighsInt el = change_el; el < new_num_nz; el++) {
-      lp.a_matrix_.index_[el] = lp.a_matrix_.index_[el + 1];
-      lp.a_matrix_.value_[el] = lp.a_matrix_.value_[el + 1];
+    const HighsInt num_shift = new_num_nz - change_el;
+    if (num_shift > 0) {
+      std::memmove(&lp.a_matrix_.index_[change_el],
+                   &lp.a_matrix_.index_[change_el + 1],
+                   num_shift * sizeof(HighsInt));
+      std::memmove(&lp.a_matrix_.value_[change_el],
+                   &lp.a_matrix_.value_[change_el + 1],
+                   num_shift * sizeof(double));
     }
     return;
   }
@@ -1539,33 +1737,22 @@ void changeLpIntegrality(HighsLp& lp,
   limits(index_collection, from_k, to_k);
   if (from_k > to_k) return;
 
-  const bool& interval = index_collection.is_interval_;
-  const bool& mask = index_collection.is_mask_;
-  const vector<HighsInt>& col_set = index_collection.set_;
-  const vector<HighsInt>& col_mask = index_collection.mask_;
-
-  // Change the integrality to the user-supplied integrality, according to the
-  // technique
-  HighsInt lp_col;
-  HighsInt usr_col = -1;
+  // Change the integrality to the user-supplied integrality, according
+  // to the technique
+  //
   // May be adding integrality to a pure LP for which lp.integrality_
   // is of size 0.
   lp.integrality_.resize(lp.num_col_);
-  for (HighsInt k = from_k; k < to_k + 1; k++) {
-    if (interval || mask) {
-      lp_col = k;
-    } else {
-      lp_col = col_set[k];
-    }
-    HighsInt col = lp_col;
-    if (interval) {
-      usr_col++;
-    } else {
-      usr_col = k;
-    }
-    if (mask && !col_mask[col]) continue;
-    lp.integrality_[col] = new_integrality[usr_col];
+  if (index_collection.is_interval_) {
+    // Interval selection copies a contiguous range
+    std::memcpy(&lp.integrality_[from_k], new_integrality.data(),
+                (to_k + 1 - from_k) * sizeof(HighsVarType));
+    return;
   }
+  forEachSelected(index_collection,
+                  [&](const HighsInt col, const HighsInt usr_col) {
+                    lp.integrality_[col] = new_integrality[usr_col];
+                  });
 }
 
 void changeLpCosts(HighsLp& lp, const HighsIndexCollection& index_collection,
@@ -1576,29 +1763,18 @@ void changeLpCosts(HighsLp& lp, const HighsIndexCollection& index_collection,
   limits(index_collection, from_k, to_k);
   if (from_k > to_k) return;
 
-  const bool& interval = index_collection.is_interval_;
-  const bool& mask = index_collection.is_mask_;
-  const vector<HighsInt>& col_set = index_collection.set_;
-  const vector<HighsInt>& col_mask = index_collection.mask_;
-
-  // Change the costs to the user-supplied costs, according to the technique
-  HighsInt lp_col;
-  HighsInt usr_col = -1;
-  for (HighsInt k = from_k; k < to_k + 1; k++) {
-    if (interval || mask) {
-      lp_col = k;
-    } else {
-      lp_col = col_set[k];
-    }
-    HighsInt col = lp_col;
-    if (interval) {
-      usr_col++;
-    } else {
-      usr_col = k;
-    }
-    if (mask && !col_mask[col]) continue;
-    lp.col_cost_[col] = new_col_cost[usr_col];
+  // Change the costs to the user-supplied costs, according to the
+  // technique
+  if (index_collection.is_interval_) {
+    // Interval selection copies a contiguous range
+    std::memcpy(&lp.col_cost_[from_k], new_col_cost.data(),
+                (to_k + 1 - from_k) * sizeof(double));
+    return;
   }
+  forEachSelected(index_collection,
+                  [&](const HighsInt col, const HighsInt usr_col) {
+                    lp.col_cost_[col] = new_col_cost[usr_col];
+                  });
 }
 
 void changeLpColBounds(HighsLp& lp,
@@ -1627,36 +1803,42 @@ void changeBounds(vector<double>& lower, vector<double>& upper,
   limits(index_collection, from_k, to_k);
   if (from_k > to_k) return;
 
-  const bool& interval = index_collection.is_interval_;
-  const bool& mask = index_collection.is_mask_;
-  const vector<HighsInt>& ix_set = index_collection.set_;
-  const vector<HighsInt>& ix_mask = index_collection.mask_;
-
-  // Change the bounds to the user-supplied bounds, according to the technique
-  HighsInt lp_ix;
-  HighsInt usr_ix = -1;
-  for (HighsInt k = from_k; k < to_k + 1; k++) {
-    if (interval || mask) {
-      lp_ix = k;
-    } else {
-      lp_ix = ix_set[k];
-    }
-    HighsInt ix = lp_ix;
-    if (interval) {
-      usr_ix++;
-    } else {
-      usr_ix = k;
-    }
-    if (mask && !ix_mask[ix]) continue;
-    lower[ix] = new_lower[usr_ix];
-    upper[ix] = new_upper[usr_ix];
+  // Change the bounds to the user-supplied bounds, according to the
+  // technique
+  if (index_collection.is_interval_) {
+    // Interval selection copies contiguous ranges
+    const size_t num_byte = (to_k + 1 - from_k) * sizeof(double);
+    std::memcpy(&lower[from_k], new_lower.data(), num_byte);
+    std::memcpy(&upper[from_k], new_upper.data(), num_byte);
+    return;
   }
+  forEachSelected(index_collection,
+                  [&](const HighsInt ix, const HighsInt usr_ix) {
+                    lower[ix] = new_lower[usr_ix];
+                    upper[ix] = new_upper[usr_ix];
+                  });
 }
 
 HighsInt getNumInt(const HighsLp& lp) {
   HighsInt num_int = 0;
   if (lp.integrality_.size()) {
-    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    const HighsInt num_col = lp.num_col_;
+    HighsInt iCol = 0;
+#if defined(__AVX2__)
+    // HighsVarType is a uint8_t enum, so 32 entries are compared
+    // against kInteger per step and the match mask popcounted
+    const uint8_t* integrality =
+        reinterpret_cast<const uint8_t*>(lp.integrality_.data());
+    const __m256i target =
+        _mm256_set1_epi8(static_cast<char>(HighsVarType::kInteger));
+    for (; iCol + 32 <= num_col; iCol += 32) {
+      const __m256i chunk = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(&integrality[iCol]));
+      num_int += highsPopcount32(static_cast<unsigned>(
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, target))));
+    }
+#endif
+    for (; iCol < num_col; iCol++)
       if (lp.integrality_[iCol] == HighsVarType::kInteger) num_int++;
   }
   return num_int;
@@ -1666,8 +1848,9 @@ void getLpCosts(const HighsLp& lp, const HighsInt from_col,
                 const HighsInt to_col, double* XcolCost) {
   assert(0 <= from_col && to_col < lp.num_col_);
   if (from_col > to_col) return;
-  for (HighsInt col = from_col; col < to_col + 1; col++)
-    XcolCost[col - from_col] = lp.col_cost_[col];
+  // Contiguous range into a caller buffer: copy it in bulk
+  std::memcpy(XcolCost, &lp.col_cost_[from_col],
+              (to_col + 1 - from_col) * sizeof(double));
 }
 
 void getLpColBounds(const HighsLp& lp, const HighsInt from_col,
@@ -1675,10 +1858,11 @@ void getLpColBounds(const HighsLp& lp, const HighsInt from_col,
                     double* XcolUpper) {
   assert(0 <= from_col && to_col < lp.num_col_);
   if (from_col > to_col) return;
-  for (HighsInt col = from_col; col < to_col + 1; col++) {
-    if (XcolLower != NULL) XcolLower[col - from_col] = lp.col_lower_[col];
-    if (XcolUpper != NULL) XcolUpper[col - from_col] = lp.col_upper_[col];
-  }
+  const size_t num_byte = (to_col + 1 - from_col) * sizeof(double);
+  if (XcolLower != NULL)
+    std::memcpy(XcolLower, &lp.col_lower_[from_col], num_byte);
+  if (XcolUpper != NULL)
+    std::memcpy(XcolUpper, &lp.col_upper_[from_col], num_byte);
 }
 
 void getLpRowBounds(const HighsLp& lp, const HighsInt from_row,
@@ -1686,10 +1870,11 @@ void getLpRowBounds(const HighsLp& lp, const HighsInt from_row,
                     double* XrowUpper) {
   assert(0 <= to_row && from_row < lp.num_row_);
   if (from_row > to_row) return;
-  for (HighsInt row = from_row; row < to_row + 1; row++) {
-    if (XrowLower != NULL) XrowLower[row - from_row] = lp.row_lower_[row];
-    if (XrowUpper != NULL) XrowUpper[row - from_row] = lp.row_upper_[row];
-  }
+  const size_t num_byte = (to_row + 1 - from_row) * sizeof(double);
+  if (XrowLower != NULL)
+    std::memcpy(XrowLower, &lp.row_lower_[from_row], num_byte);
+  if (XrowUpper != NULL)
+    std::memcpy(XrowUpper, &lp.row_upper_[from_row], num_byte);
 }
 
 // Get a single coefficient from the matrix
@@ -1698,14 +1883,7 @@ void getLpMatrixCoefficient(const HighsLp& lp, const HighsInt Xrow,
   assert(0 <= Xrow && Xrow < lp.num_row_);
   assert(0 <= Xcol && Xcol < lp.num_col_);
 
-  HighsInt get_el = -1;
-  for (HighsInt el = lp.a_matrix_.start_[Xcol];
-       el < lp.a_matrix_.start_[Xcol + 1]; el++) {
-    if (lp.a_matrix_.index_[el] == Xrow) {
-      get_el = el;
-      break;
-    }
-  }
+  const HighsInt get_el = findLpMatrixEntry(lp, Xrow, Xcol);
   if (get_el < 0) {
     *val = 0;
   } else {
@@ -1718,9 +1896,11 @@ void getLpMatrixCoefficient(const HighsLp& lp, const HighsInt Xrow,
 // Report the whole LP
 void reportLp(const HighsLogOptions& log_options, const HighsLp& lp,
               const HighsLogType report_level) {
-  reportLpBrief(log_options, lp);
+  // Count the integer columns once for the whole report
+  const HighsInt num_int = getNumInt(lp);
+  reportLpBrief(log_options, lp, num_int);
   if ((HighsInt)report_level >= (HighsInt)HighsLogType::kDetailed) {
-    reportLpColVectors(log_options, lp);
+    reportLpColVectors(log_options, lp, num_int);
     reportLpRowVectors(log_options, lp);
     if ((HighsInt)report_level >= (HighsInt)HighsLogType::kVerbose)
       reportLpColMatrix(log_options, lp);
@@ -1728,13 +1908,15 @@ void reportLp(const HighsLogOptions& log_options, const HighsLp& lp,
 }
 
 // Report the LP briefly
-void reportLpBrief(const HighsLogOptions& log_options, const HighsLp& lp) {
-  reportLpDimensions(log_options, lp);
+void reportLpBrief(const HighsLogOptions& log_options, const HighsLp& lp,
+                   const HighsInt num_int) {
+  reportLpDimensions(log_options, lp, num_int);
   reportLpObjSense(log_options, lp);
 }
 
 // Report the LP dimensions
-void reportLpDimensions(const HighsLogOptions& log_options, const HighsLp& lp) {
+void reportLpDimensions(const HighsLogOptions& log_options, const HighsLp& lp,
+                        const HighsInt num_int) {
   HighsInt lp_num_nz;
   if (lp.num_col_ == 0)
     lp_num_nz = 0;
@@ -1743,15 +1925,16 @@ void reportLpDimensions(const HighsLogOptions& log_options, const HighsLp& lp) {
   highsLogUser(log_options, HighsLogType::kInfo,
                "LP has %" HIGHSINT_FORMAT " columns, %" HIGHSINT_FORMAT " rows",
                lp.num_col_, lp.num_row_);
-  HighsInt num_int = getNumInt(lp);
-  if (num_int) {
+  const HighsInt use_num_int = num_int >= 0 ? num_int : getNumInt(lp);
+  if (use_num_int) {
     highsLogUser(log_options, HighsLogType::kInfo,
                  ", %" HIGHSINT_FORMAT " nonzeros and %" HIGHSINT_FORMAT
                  " integer columns\n",
-                 lp_num_nz, num_int);
+                 lp_num_nz, use_num_int);
   } else {
     highsLogUser(log_options, HighsLogType::kInfo,
-                 " and %" HIGHSINT_FORMAT " nonzeros\n", lp_num_nz, num_int);
+                 " and %" HIGHSINT_FORMAT " nonzeros\n", lp_num_nz,
+                 use_num_int);
   }
 }
 
@@ -1769,34 +1952,24 @@ void reportLpObjSense(const HighsLogOptions& log_options, const HighsLp& lp) {
                  lp.sense_);
 }
 
-static std::string getBoundType(const double lower, const double upper) {
-  std::string type;
-  if (highs_isInfinity(-lower)) {
-    if (highs_isInfinity(upper)) {
-      type = "FR";
-    } else {
-      type = "UB";
-    }
-  } else {
-    if (highs_isInfinity(upper)) {
-      type = "LB";
-    } else {
-      if (lower < upper) {
-        type = "BX";
-      } else {
-        type = "FX";
-      }
-    }
-  }
-  return type;
+// Returns a string literal, so callers in per-column/row report loops
+// don't pay a string allocation per entry. The two infinity tests key
+// a lookup table, leaving a compare only for the all-finite case
+static const char* getBoundType(const double lower, const double upper) {
+  static const char* const kBoundType[4] = {nullptr, "LB", "UB", "FR"};
+  const int ix =
+      (highs_isInfinity(-lower) << 1) | (highs_isInfinity(upper) ? 1 : 0);
+  if (ix) return kBoundType[ix];
+  return lower < upper ? "BX" : "FX";
 }
 
 // Report the vectors of LP column data
-void reportLpColVectors(const HighsLogOptions& log_options, const HighsLp& lp) {
+void reportLpColVectors(const HighsLogOptions& log_options, const HighsLp& lp,
+                        const HighsInt num_int) {
   if (lp.num_col_ <= 0) return;
-  std::string type;
+  const char* type;
   HighsInt count;
-  bool have_integer_columns = getNumInt(lp);
+  bool have_integer_columns = (num_int >= 0 ? num_int : getNumInt(lp)) > 0;
   bool have_col_names = lp.col_names_.size();
 
   highsLogUser(log_options, HighsLogType::kInfo,
@@ -1807,44 +1980,88 @@ void reportLpColVectors(const HighsLogOptions& log_options, const HighsLp& lp) {
   if (have_col_names) highsLogUser(log_options, HighsLogType::kInfo, "  Name");
   highsLogUser(log_options, HighsLogType::kInfo, "\n");
 
+  // Precompute the column counts in one vectorizable differencing
+  // pass, keeping the start_ loads out of the log-formatting loop
+  vector<HighsInt> col_nnz(lp.num_col_);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    col_nnz[iCol] = lp.a_matrix_.start_[iCol + 1] - lp.a_matrix_.start_[iCol];
+  // One highsLogUser call per column: the format variant is selected
+  // by the loop-invariant discrete/name flags rather than issuing up
+  // to four calls per line
   for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
     type = getBoundType(lp.col_lower_[iCol], lp.col_upper_[iCol]);
-    count = lp.a_matrix_.start_[iCol + 1] - lp.a_matrix_.start_[iCol];
-    highsLogUser(log_options, HighsLogType::kInfo,
-                 "%8" HIGHSINT_FORMAT
-                 " %12g %12g %12g         %2s %12" HIGHSINT_FORMAT "",
-                 iCol, lp.col_lower_[iCol], lp.col_upper_[iCol],
-                 lp.col_cost_[iCol], type.c_str(), count);
-    if (have_integer_columns) {
-      std::string integer_column = "";
-      if (lp.integrality_[iCol] == HighsVarType::kInteger) {
-        if (lp.col_lower_[iCol] == 0 && lp.col_upper_[iCol] == 1) {
-          integer_column = "Binary";
-        } else {
-          integer_column = "Integer";
-        }
+    count = col_nnz[iCol];
+    const char* integer_column = "";
+    if (have_integer_columns &&
+        lp.integrality_[iCol] == HighsVarType::kInteger) {
+      if (lp.col_lower_[iCol] == 0 && lp.col_upper_[iCol] == 1) {
+        integer_column = "Binary";
+      } else {
+        integer_column = "Integer";
       }
-      highsLogUser(log_options, HighsLogType::kInfo, "  %-8s",
-                   integer_column.c_str());
     }
-    if (have_col_names)
-      highsLogUser(log_options, HighsLogType::kInfo, "  %-s",
+    if (have_integer_columns && have_col_names) {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g %12g         %2s %12" HIGHSINT_FORMAT
+                   "  %-8s  %-s\n",
+                   iCol, lp.col_lower_[iCol], lp.col_upper_[iCol],
+                   lp.col_cost_[iCol], type, count, integer_column,
                    lp.col_names_[iCol].c_str());
-    highsLogUser(log_options, HighsLogType::kInfo, "\n");
+    } else if (have_integer_columns) {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g %12g         %2s %12" HIGHSINT_FORMAT
+                   "  %-8s\n",
+                   iCol, lp.col_lower_[iCol], lp.col_upper_[iCol],
+                   lp.col_cost_[iCol], type, count, integer_column);
+    } else if (have_col_names) {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g %12g         %2s %12" HIGHSINT_FORMAT
+                   "  %-s\n",
+                   iCol, lp.col_lower_[iCol], lp.col_upper_[iCol],
+                   lp.col_cost_[iCol], type, count,
+                   lp.col_names_[iCol].c_str());
+    } else {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g %12g         %2s %12" HIGHSINT_FORMAT "\n",
+                   iCol, lp.col_lower_[iCol], lp.col_upper_[iCol],
+                   lp.col_cost_[iCol], type, count);
+    }
   }
 }
 
 // Report the vectors of LP row data
 void reportLpRowVectors(const HighsLogOptions& log_options, const HighsLp& lp) {
   if (lp.num_row_ <= 0) return;
-  std::string type;
+  const char* type;
   vector<HighsInt> count;
   bool have_row_names = lp.row_names_.size();
 
   count.resize(lp.num_row_, 0);
   if (lp.num_col_ > 0) {
-    for (HighsInt el = 0; el < lp.a_matrix_.start_[lp.num_col_]; el++)
-      count[lp.a_matrix_.index_[el]]++;
+    // Stripe the histogram over four privatized bucket arrays to break
+    // the store-to-load dependence between consecutive increments of
+    // the same row's counter
+    const HighsInt num_nz = lp.a_matrix_.start_[lp.num_col_];
+    const HighsInt* index = lp.a_matrix_.index_.data();
+    vector<HighsInt> stripe(3 * lp.num_row_, 0);
+    HighsInt* bucket0 = count.data();
+    HighsInt* bucket1 = stripe.data();
+    HighsInt* bucket2 = bucket1 + lp.num_row_;
+    HighsInt* bucket3 = bucket2 + lp.num_row_;
+    HighsInt el = 0;
+    for (; el + 4 <= num_nz; el += 4) {
+      bucket0[index[el]]++;
+      bucket1[index[el + 1]]++;
+      bucket2[index[el + 2]]++;
+      bucket3[index[el + 3]]++;
+    }
+    for (; el < num_nz; el++) bucket0[index[el]]++;
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+      count[iRow] += bucket1[iRow] + bucket2[iRow] + bucket3[iRow];
   }
 
   highsLogUser(log_options, HighsLogType::kInfo,
@@ -1852,18 +2069,23 @@ void reportLpRowVectors(const HighsLogOptions& log_options, const HighsLp& lp) {
   if (have_row_names) highsLogUser(log_options, HighsLogType::kInfo, "  Name");
   highsLogUser(log_options, HighsLogType::kInfo, "\n");
 
+  // As for the columns, one call per row with the name folded into the
+  // format when present
   for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
     type = getBoundType(lp.row_lower_[iRow], lp.row_upper_[iRow]);
-    std::string name = "";
-    highsLogUser(log_options, HighsLogType::kInfo,
-                 "%8" HIGHSINT_FORMAT
-                 " %12g %12g         %2s %12" HIGHSINT_FORMAT "",
-                 iRow, lp.row_lower_[iRow], lp.row_upper_[iRow], type.c_str(),
-                 count[iRow]);
-    if (have_row_names)
-      highsLogUser(log_options, HighsLogType::kInfo, "  %-s",
-                   lp.row_names_[iRow].c_str());
-    highsLogUser(log_options, HighsLogType::kInfo, "\n");
+    if (have_row_names) {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g         %2s %12" HIGHSINT_FORMAT "  %-s\n",
+                   iRow, lp.row_lower_[iRow], lp.row_upper_[iRow], type,
+                   count[iRow], lp.row_names_[iRow].c_str());
+    } else {
+      highsLogUser(log_options, HighsLogType::kInfo,
+                   "%8" HIGHSINT_FORMAT
+                   " %12g %12g         %2s %12" HIGHSINT_FORMAT "\n",
+                   iRow, lp.row_lower_[iRow], lp.row_upper_[iRow], type,
+                   count[iRow]);
+    }
   }
 }
 
@@ -1884,13 +2106,13 @@ void reportLpColMatrix(const HighsLogOptions& log_options, const HighsLp& lp) {
   }
 }
 
-void reportMatrix(const HighsLogOptions& log_options, const std::string message,
+void reportMatrix(const HighsLogOptions& log_options, const char* message,
                   const HighsInt num_col, const HighsInt num_nz,
                   const HighsInt* start, const HighsInt* index,
                   const double* value) {
   if (num_col <= 0) return;
   highsLogUser(log_options, HighsLogType::kInfo,
-               "%-7s Index              Value\n", message.c_str());
+               "%-7s Index              Value\n", message);
   for (HighsInt col = 0; col < num_col; col++) {
     highsLogUser(log_options, HighsLogType::kInfo,
                  "    %8" HIGHSINT_FORMAT " Start   %10" HIGHSINT_FORMAT "\n",
@@ -1906,23 +2128,9 @@ void reportMatrix(const HighsLogOptions& log_options, const std::string message,
 }
 
 void analyseLp(const HighsLogOptions& log_options, const HighsLp& lp) {
-  vector<double> min_colBound;
-  vector<double> min_rowBound;
-  vector<double> colRange;
-  vector<double> rowRange;
-  min_colBound.resize(lp.num_col_);
-  min_rowBound.resize(lp.num_row_);
-  colRange.resize(lp.num_col_);
-  rowRange.resize(lp.num_row_);
-  for (HighsInt col = 0; col < lp.num_col_; col++)
-    min_colBound[col] = min(fabs(lp.col_lower_[col]), fabs(lp.col_upper_[col]));
-  for (HighsInt row = 0; row < lp.num_row_; row++)
-    min_rowBound[row] = min(fabs(lp.row_lower_[row]), fabs(lp.row_upper_[row]));
-  for (HighsInt col = 0; col < lp.num_col_; col++)
-    colRange[col] = lp.col_upper_[col] - lp.col_lower_[col];
-  for (HighsInt row = 0; row < lp.num_row_; row++)
-    rowRange[row] = lp.row_upper_[row] - lp.row_lower_[row];
-
+  // The min-abs-bound and range statistics are computed on the fly by
+  // the accessor overload of analyseVectorValues, rather than being
+  // materialized in temporary vectors and re-read
   std::string message;
   if (lp.is_scaled_) {
     message = "Scaled";
@@ -1944,18 +2152,30 @@ void analyseLp(const HighsLogOptions& log_options, const HighsLp& lp) {
                       lp.col_lower_, true, lp.model_name_);
   analyseVectorValues(&log_options, "Column upper bounds", lp.num_col_,
                       lp.col_upper_, true, lp.model_name_);
-  analyseVectorValues(&log_options, "Column min abs bound", lp.num_col_,
-                      min_colBound, true, lp.model_name_);
-  analyseVectorValues(&log_options, "Column range", lp.num_col_, colRange, true,
-                      lp.model_name_);
+  analyseVectorValues(
+      &log_options, "Column min abs bound", lp.num_col_,
+      [&lp](HighsInt iCol) {
+        return min(fabs(lp.col_lower_[iCol]), fabs(lp.col_upper_[iCol]));
+      },
+      true, lp.model_name_);
+  analyseVectorValues(
+      &log_options, "Column range", lp.num_col_,
+      [&lp](HighsInt iCol) { return lp.col_upper_[iCol] - lp.col_lower_[iCol]; },
+      true, lp.model_name_);
   analyseVectorValues(&log_options, "Row lower bounds", lp.num_row_,
                       lp.row_lower_, true, lp.model_name_);
   analyseVectorValues(&log_options, "Row upper bounds", lp.num_row_,
                       lp.row_upper_, true, lp.model_name_);
-  analyseVectorValues(&log_options, "Row min abs bound", lp.num_row_,
-                      min_rowBound, true, lp.model_name_);
-  analyseVectorValues(&log_options, "Row range", lp.num_row_, rowRange, true,
-                      lp.model_name_);
+  analyseVectorValues(
+      &log_options, "Row min abs bound", lp.num_row_,
+      [&lp](HighsInt iRow) {
+        return min(fabs(lp.row_lower_[iRow]), fabs(lp.row_upper_[iRow]));
+      },
+      true, lp.model_name_);
+  analyseVectorValues(
+      &log_options, "Row range", lp.num_row_,
+      [&lp](HighsInt iRow) { return lp.row_upper_[iRow] - lp.row_lower_[iRow]; },
+      true, lp.model_name_);
   analyseVectorValues(&log_options, "Matrix sparsity",
                       lp.a_matrix_.start_[lp.num_col_], lp.a_matrix_.value_,
                       true, lp.model_name_);
@@ -2377,12 +2597,27 @@ void writeBasisFile(FILE*& file, const HighsBasis& basis) {
     return;
   }
   fprintf(file, "Valid\n");
+  // Statuses are single digits, so batch each status line into one
+  // buffer and write it with a single fwrite rather than paying an
+  // fprintf per entry
+  std::string line;
+  line.reserve(2 * std::max(basis.col_status.size(), basis.row_status.size()) +
+               1);
   fprintf(file, "# Columns %d\n", (int)basis.col_status.size());
-  for (const auto& status : basis.col_status) fprintf(file, "%d ", (int)status);
-  fprintf(file, "\n");
+  for (const auto& status : basis.col_status) {
+    line += static_cast<char>('0' + (int)status);
+    line += ' ';
+  }
+  line += '\n';
+  fwrite(line.data(), 1, line.size(), file);
   fprintf(file, "# Rows %d\n", (int)basis.row_status.size());
-  for (const auto& status : basis.row_status) fprintf(file, "%d ", (int)status);
-  fprintf(file, "\n");
+  line.clear();
+  for (const auto& status : basis.row_status) {
+    line += static_cast<char>('0' + (int)status);
+    line += ' ';
+  }
+  line += '\n';
+  fwrite(line.data(), 1, line.size(), file);
 }
 
 HighsStatus readBasisFile(const HighsLogOptions& log_options, HighsBasis& basis,
@@ -2403,6 +2638,34 @@ HighsStatus readBasisFile(const HighsLogOptions& log_options, HighsBasis& basis,
   return return_status;
 }
 
+// Reads count basis statuses by pulling whole lines and parsing the
+// integers in place: formatted extraction with operator>> pays locale
+// and error-flag machinery per value
+static bool readBasisStatuses(std::ifstream& in_file, const HighsInt count,
+                              std::vector<HighsBasisStatus>& status) {
+  std::string line;
+  HighsInt num_read = 0;
+  while (num_read < count) {
+    if (!std::getline(in_file, line)) return false;
+    const char* p = line.c_str();
+    const char* end = p + line.size();
+    while (p < end && num_read < count) {
+      while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+      if (p >= end) break;
+      HighsInt value = 0;
+      bool any_digit = false;
+      while (p < end && *p >= '0' && *p <= '9') {
+        value = 10 * value + (*p - '0');
+        p++;
+        any_digit = true;
+      }
+      if (!any_digit) return false;
+      status[num_read++] = (HighsBasisStatus)value;
+    }
+  }
+  return true;
+}
+
 HighsStatus readBasisStream(const HighsLogOptions& log_options,
                             HighsBasis& basis, std::ifstream& in_file) {
   // Reads a basis as an ifstream, returning an error if what's read is
@@ -2419,7 +2682,6 @@ HighsStatus readBasisStream(const HighsLogOptions& log_options,
     }
     const HighsInt basis_num_col = (HighsInt)basis.col_status.size();
     const HighsInt basis_num_row = (HighsInt)basis.row_status.size();
-    HighsInt int_status;
     assert(keyword == "Valid");
     HighsInt num_col, num_row;
     // Read in the columns section
@@ -2433,9 +2695,10 @@ HighsStatus readBasisStream(const HighsLogOptions& log_options,
                    num_col, basis_num_col);
       return HighsStatus::kError;
     }
-    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
-      in_file >> int_status;
-      basis.col_status[iCol] = (HighsBasisStatus)int_status;
+    if (!readBasisStatuses(in_file, num_col, basis.col_status)) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "readBasisFile: Error reading column statuses\n");
+      return HighsStatus::kError;
     }
     // Read in the rows section
     in_file >> keyword >> keyword;
@@ -2448,9 +2711,10 @@ HighsStatus readBasisStream(const HighsLogOptions& log_options,
                    num_row, basis_num_row);
       return HighsStatus::kError;
     }
-    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
-      in_file >> int_status;
-      basis.row_status[iRow] = (HighsBasisStatus)int_status;
+    if (!readBasisStatuses(in_file, num_row, basis.row_status)) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "readBasisFile: Error reading row statuses\n");
+      return HighsStatus::kError;
     }
   } else {
     highsLogUser(log_options, HighsLogType::kError,
@@ -2461,6 +2725,42 @@ HighsStatus readBasisStream(const HighsLogOptions& log_options,
   return return_status;
 }
 
+// Dot product of the packed entries [from_el, to_el) with the dense
+// vector they index. On AVX2 builds with 32-bit HighsInt, four
+// nonzeros are processed per step, gathering the dense operands
+static double packedDotProduct(const HighsInt from_el, const HighsInt to_el,
+                               const HighsInt* index, const double* value,
+                               const double* dense) {
+  double result = 0.0;
+  HighsInt i = from_el;
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+  // Columns shorter than one vector go straight to the scalar loop,
+  // skipping the accumulator set-up and horizontal reduction
+  if (to_el - from_el >= 4) {
+    __m256d acc = _mm256_setzero_pd();
+    // masked gather with a zeroed source: same instruction as the
+    // unmasked form without its uninitialized pass-through operand
+    const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+    for (; i + 4 <= to_el; i += 4) {
+      const __m128i idx =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&index[i]));
+      const __m256d gathered =
+          _mm256_mask_i32gather_pd(_mm256_setzero_pd(), dense, idx,
+                                   all_lanes, 8);
+      acc = _mm256_add_pd(acc,
+                          _mm256_mul_pd(_mm256_loadu_pd(&value[i]), gathered));
+    }
+    __m128d lo128 =
+        _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    result = _mm_cvtsd_f64(_mm_hadd_pd(lo128, lo128));
+  }
+#endif
+  for (; i < to_el; i++) result += value[i] * dense[index[i]];
+  return result;
+}
+
+const HighsInt kCalculateColDualsParallelMinNz = 65536;
+
 HighsStatus calculateColDuals(const HighsLp& lp, HighsSolution& solution) {
   //  assert(solution.row_dual.size() > 0);
   if (int(solution.row_dual.size()) < lp.num_row_) return HighsStatus::kError;
@@ -2468,18 +2768,32 @@ HighsStatus calculateColDuals(const HighsLp& lp, HighsSolution& solution) {
   assert(is_colwise);
   if (!is_colwise) return HighsStatus::kError;
 
-  solution.col_dual.assign(lp.num_col_, 0);
+  solution.col_dual.resize(lp.num_col_);
 
-  for (HighsInt col = 0; col < lp.num_col_; col++) {
-    for (HighsInt i = lp.a_matrix_.start_[col];
-         i < lp.a_matrix_.start_[col + 1]; i++) {
-      const HighsInt row = lp.a_matrix_.index_[i];
-      assert(row >= 0);
-      assert(row < lp.num_row_);
+  const HighsInt* __restrict start = lp.a_matrix_.start_.data();
+  const HighsInt* __restrict index = lp.a_matrix_.index_.data();
+  const double* __restrict value = lp.a_matrix_.value_.data();
+  const double* __restrict row_dual = solution.row_dual.data();
+  const double* __restrict col_cost = lp.col_cost_.data();
+  double* __restrict col_dual = solution.col_dual.data();
+  auto computeDuals = [&](const HighsInt from_col, const HighsInt to_col) {
+    for (HighsInt col = from_col; col < to_col; col++) {
       // @FlipRowDual -= became +=
-      solution.col_dual[col] += solution.row_dual[row] * lp.a_matrix_.value_[i];
-    }
-    solution.col_dual[col] += lp.col_cost_[col];
+      col_dual[col] = col_cost[col] + packedDotProduct(start[col],
+                                                       start[col + 1], index,
+                                                       value, row_dual);
+    }
+  };
+  // Each column writes only its own dual, so the loop parallelizes
+  // over column ranges when the matrix is large enough to amortize the
+  // task overhead and this thread belongs to the scheduler
+  const bool parallel =
+      lp.a_matrix_.start_[lp.num_col_] >= kCalculateColDualsParallelMinNz &&
+      HighsTaskExecutor::getThisWorkerDeque() != nullptr;
+  if (parallel) {
+    highs::parallel::for_each(0, lp.num_col_, computeDuals, 4096);
+  } else {
+    computeDuals(0, lp.num_col_);
   }
 
   return HighsStatus::kOk;
@@ -2494,17 +2808,27 @@ HighsStatus calculateRowValues(const HighsLp& lp,
   assert(is_colwise);
   if (!is_colwise) return HighsStatus::kError;
 
-  row_value.clear();
+  // assign alone zero-fills in place, reallocating only if the
+  // capacity is short; the previous clear() added nothing but a
+  // destroy pass
   row_value.assign(lp.num_row_, 0);
 
+  const HighsInt* __restrict start = lp.a_matrix_.start_.data();
+  const HighsInt* __restrict index = lp.a_matrix_.index_.data();
+  const double* __restrict value = lp.a_matrix_.value_.data();
+  double* __restrict row_value_p = row_value.data();
   for (HighsInt col = 0; col < lp.num_col_; col++) {
-    for (HighsInt i = lp.a_matrix_.start_[col];
-         i < lp.a_matrix_.start_[col + 1]; i++) {
-      const HighsInt row = lp.a_matrix_.index_[i];
+    // Hoist the column's value and skip zero columns, which contribute
+    // nothing and are common in sparse solutions
+    const double xval = col_value[col];
+    if (xval == 0.0) continue;
+    const HighsInt to_el = start[col + 1];
+    for (HighsInt i = start[col]; i < to_el; i++) {
+      const HighsInt row = index[i];
       assert(row >= 0);
       assert(row < lp.num_row_);
 
-      row_value[row] += col_value[col] * lp.a_matrix_.value_[i];
+      row_value_p[row] += xval * value[i];
     }
   }
 
@@ -2546,12 +2870,32 @@ HighsStatus calculateRowValuesQuad(const HighsLp& lp, HighsSolution& solution) {
   return HighsStatus::kOk;
 }
 
+// Number of positions where upper[i] < lower[i]. On AVX2 builds the
+// compare runs four pairs per step with a popcounted mask, avoiding a
+// data-dependent branch per entry
+static HighsInt countInconsistentBounds(const double* lower,
+                                        const double* upper,
+                                        const HighsInt count) {
+  HighsInt num_inconsistent = 0;
+  HighsInt i = 0;
+#if defined(__AVX2__)
+  for (; i + 4 <= count; i += 4) {
+    const int lanes = _mm256_movemask_pd(_mm256_cmp_pd(
+        _mm256_loadu_pd(&upper[i]), _mm256_loadu_pd(&lower[i]), _CMP_LT_OQ));
+    num_inconsistent += highsPopcount32(static_cast<unsigned>(lanes));
+  }
+#endif
+  for (; i < count; i++)
+    if (upper[i] < lower[i]) num_inconsistent++;
+  return num_inconsistent;
+}
+
 bool isBoundInfeasible(const HighsLogOptions& log_options, const HighsLp& lp) {
-  HighsInt num_bound_infeasible = 0;
-  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
-    if (lp.col_upper_[iCol] < lp.col_lower_[iCol]) num_bound_infeasible++;
-  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
-    if (lp.row_upper_[iRow] < lp.row_lower_[iRow]) num_bound_infeasible++;
+  const HighsInt num_bound_infeasible =
+      countInconsistentBounds(lp.col_lower_.data(), lp.col_upper_.data(),
+                              lp.num_col_) +
+      countInconsistentBounds(lp.row_lower_.data(), lp.row_upper_.data(),
+                              lp.num_row_);
   if (num_bound_infeasible > 0)
     highsLogUser(log_options, HighsLogType::kInfo,
                  "Model infeasible due to %" HIGHSINT_FORMAT
@@ -2560,49 +2904,42 @@ bool isBoundInfeasible(const HighsLogOptions& log_options, const HighsLp& lp) {
   return num_bound_infeasible > 0;
 }
 
+// The checks below must all run - each logs its own message - so their
+// results combine with bitwise OR rather than the short-circuiting
+// "f() || null_data" idiom, which also left the calls
+// control-dependent on one another
 bool isColDataNull(const HighsLogOptions& log_options,
                    const double* usr_col_cost, const double* usr_col_lower,
                    const double* usr_col_upper) {
-  bool null_data = false;
-  null_data =
-      doubleUserDataNotNull(log_options, usr_col_cost, "column costs") ||
-      null_data;
-  null_data = doubleUserDataNotNull(log_options, usr_col_lower,
-                                    "column lower bounds") ||
-              null_data;
-  null_data = doubleUserDataNotNull(log_options, usr_col_upper,
-                                    "column upper bounds") ||
-              null_data;
-  return null_data;
+  const bool cost_null =
+      doubleUserDataNotNull(log_options, usr_col_cost, "column costs");
+  const bool lower_null =
+      doubleUserDataNotNull(log_options, usr_col_lower, "column lower bounds");
+  const bool upper_null =
+      doubleUserDataNotNull(log_options, usr_col_upper, "column upper bounds");
+  return cost_null | lower_null | upper_null;
 }
 
 bool isRowDataNull(const HighsLogOptions& log_options,
                    const double* usr_row_lower, const double* usr_row_upper) {
-  bool null_data = false;
-  null_data =
-      doubleUserDataNotNull(log_options, usr_row_lower, "row lower bounds") ||
-      null_data;
-  null_data =
-      doubleUserDataNotNull(log_options, usr_row_upper, "row upper bounds") ||
-      null_data;
-  return null_data;
+  const bool lower_null =
+      doubleUserDataNotNull(log_options, usr_row_lower, "row lower bounds");
+  const bool upper_null =
+      doubleUserDataNotNull(log_options, usr_row_upper, "row upper bounds");
+  return lower_null | upper_null;
 }
 
 bool isMatrixDataNull(const HighsLogOptions& log_options,
                       const HighsInt* usr_matrix_start,
                       const HighsInt* usr_matrix_index,
                       const double* usr_matrix_value) {
-  bool null_data = false;
-  null_data =
-      intUserDataNotNull(log_options, usr_matrix_start, "matrix starts") ||
-      null_data;
-  null_data =
-      intUserDataNotNull(log_options, usr_matrix_index, "matrix indices") ||
-      null_data;
-  null_data =
-      doubleUserDataNotNull(log_options, usr_matrix_value, "matrix values") ||
-      null_data;
-  return null_data;
+  const bool start_null =
+      intUserDataNotNull(log_options, usr_matrix_start, "matrix starts");
+  const bool index_null =
+      intUserDataNotNull(log_options, usr_matrix_index, "matrix indices");
+  const bool value_null =
+      doubleUserDataNotNull(log_options, usr_matrix_value, "matrix values");
+  return start_null | index_null | value_null;
 }
 
 void reportPresolveReductions(const HighsLogOptions& log_options,
@@ -2642,7 +2979,7 @@ void reportPresolveReductions(const HighsLogOptions& log_options,
   HighsInt num_col_to;
   HighsInt num_row_to;
   HighsInt num_els_to;
-  std::string message;
+  const char* message;
   if (presolve_to_empty) {
     num_col_to = 0;
     num_row_to = 0;
@@ -2662,7 +2999,7 @@ void reportPresolveReductions(const HighsLogOptions& log_options,
                "elements %" HIGHSINT_FORMAT "(-%" HIGHSINT_FORMAT ") %s\n",
                num_row_to, (num_row_from - num_row_to), num_col_to,
                (num_col_from - num_col_to), num_els_to,
-               (num_els_from - num_els_to), message.c_str());
+               (num_els_from - num_els_to), message);
 }
 
 bool isLessInfeasibleDSECandidate(const HighsLogOptions& log_options,
@@ -2675,6 +3012,25 @@ bool isLessInfeasibleDSECandidate(const HighsLogOptions& log_options,
   vector<HighsInt> col_length_k;
   col_length_k.resize(1 + max_assess_col_num_en, 0);
   bool LiDSE_candidate = true;
+  // All nonzeros must be +1 or -1: assess this in one pass over the
+  // whole value array - on AVX2 builds four entries per step, clearing
+  // the sign bits and comparing against 1 - instead of per column
+  const HighsInt num_nz = lp.a_matrix_.start_[lp.num_col_];
+  const double* value = lp.a_matrix_.value_.data();
+  HighsInt en = 0;
+#if defined(__AVX2__)
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+  const __m256d ones = _mm256_set1_pd(1.0);
+  for (; en + 4 <= num_nz; en += 4) {
+    const __m256d abs_value =
+        _mm256_and_pd(_mm256_loadu_pd(&value[en]), abs_mask);
+    if (_mm256_movemask_pd(_mm256_cmp_pd(abs_value, ones, _CMP_NEQ_UQ)))
+      return false;
+  }
+#endif
+  for (; en < num_nz; en++)
+    if (fabs(value[en]) != 1) return false;
   for (HighsInt col = 0; col < lp.num_col_; col++) {
     // Check limit on number of entries in the column has not been breached
     HighsInt col_num_en =
@@ -2682,12 +3038,6 @@ bool isLessInfeasibleDSECandidate(const HighsLogOptions& log_options,
     max_col_num_en = std::max(col_num_en, max_col_num_en);
     if (col_num_en > max_assess_col_num_en) return false;
     col_length_k[col_num_en]++;
-    for (HighsInt en = lp.a_matrix_.start_[col];
-         en < lp.a_matrix_.start_[col + 1]; en++) {
-      double value = lp.a_matrix_.value_[en];
-      // All nonzeros must be +1 or -1
-      if (fabs(value) != 1) return false;
-    }
   }
   double average_col_num_en = lp.a_matrix_.start_[lp.num_col_];
   average_col_num_en = average_col_num_en / lp.num_col_;
@@ -137,13 +137,18 @@ void reportLp(const HighsLogOptions& log_options,
  * @brief Report the brief data of an LP
  */
 void reportLpBrief(const HighsLogOptions& log_options,
-                   const HighsLp& lp  //!< LP whose data are to be reported
+                   const HighsLp& lp,  //!< LP whose data are to be reported
+                   const HighsInt num_int = -1  //!< Number of integer-valued
+                                                //!< columns, if already known
 );
 /**
  * @brief Report the data of an LP
  */
 void reportLpDimensions(const HighsLogOptions& log_options,
-                        const HighsLp& lp  //!< LP whose data are to be reported
+                        const HighsLp& lp,  //!< LP whose data are to be reported
+                        const HighsInt num_int = -1  //!< Number of
+                                                     //!< integer-valued columns,
+                                                     //!< if already known
 );
 /**
  * @brief Report the data of an LP
@@ -155,7 +160,10 @@ void reportLpObjSense(const HighsLogOptions& log_options,
  * @brief Report the data of an LP
  */
 void reportLpColVectors(const HighsLogOptions& log_options,
-                        const HighsLp& lp  //!< LP whose data are to be reported
+                        const HighsLp& lp,  //!< LP whose data are to be reported
+                        const HighsInt num_int = -1  //!< Number of
+                                                     //!< integer-valued columns,
+                                                     //!< if already known
 );
 /**
  * @brief Report the data of an LP
@@ -170,7 +178,7 @@ void reportLpColMatrix(const HighsLogOptions& log_options,
                        const HighsLp& lp  //!< LP whose data are to be reported
 );
 
-void reportMatrix(const HighsLogOptions& log_options, const std::string message,
+void reportMatrix(const HighsLogOptions& log_options, const char* message,
                   const HighsInt num_col, const HighsInt num_nz,
                   const HighsInt* start, const HighsInt* index,
                   const double* value);
@@ -197,7 +197,9 @@ void writeModelSolution(FILE* file, const HighsLp& lp,
   const bool have_row_names = lp.row_names_.size() > 0;
   const bool have_primal = solution.value_valid;
   const bool have_dual = solution.dual_valid;
-  std::stringstream ss;
+  // Constructed fallback names are formatted into a stack buffer: a
+  // stringstream here costs a string allocation per entry written
+  char name_buf[32];
   if (have_col_names) assert((int)lp.col_names_.size() >= lp.num_col_);
   if (have_row_names) assert((int)lp.row_names_.size() >= lp.num_row_);
   if (have_primal) {
@@ -243,12 +245,14 @@ void writeModelSolution(FILE* file, const HighsLp& lp,
       std::array<char, 32> valStr = highsDoubleToString(
           solution.col_value[ix], kHighsSolutionValueToStringTolerance);
       // Create a column name
-      ss.str(std::string());
-      ss << "C" << ix;
-      const std::string name = have_col_names ? lp.col_names_[ix] : ss.str();
-      fprintf(file, "%-s %s", name.c_str(), valStr.data());
-      if (sparse) fprintf(file, " %d", int(ix));
-      fprintf(file, "\n");
+      if (!have_col_names)
+        snprintf(name_buf, sizeof(name_buf), "C%" HIGHSINT_FORMAT, ix);
+      const char* name = have_col_names ? lp.col_names_[ix].c_str() : name_buf;
+      if (sparse) {
+        fprintf(file, "%-s %s %d\n", name, valStr.data(), int(ix));
+      } else {
+        fprintf(file, "%-s %s\n", name, valStr.data());
+      }
     }
     if (sparse) return;
     fprintf(file, "# Rows %" HIGHSINT_FORMAT "\n", lp.num_row_);
@@ -256,10 +260,10 @@ void writeModelSolution(FILE* file, const HighsLp& lp,
       std::array<char, 32> valStr = highsDoubleToString(
           solution.row_value[ix], kHighsSolutionValueToStringTolerance);
       // Create a row name
-      ss.str(std::string());
-      ss << "R" << ix;
-      const std::string name = have_row_names ? lp.row_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
+      if (!have_row_names)
+        snprintf(name_buf, sizeof(name_buf), "R%" HIGHSINT_FORMAT, ix);
+      const char* name = have_row_names ? lp.row_names_[ix].c_str() : name_buf;
+      fprintf(file, "%-s %s\n", name, valStr.data());
     }
   }
   fprintf(file, "\n# Dual solution values\n");
@@ -276,19 +280,19 @@ void writeModelSolution(FILE* file, const HighsLp& lp,
     for (HighsInt ix = 0; ix < lp.num_col_; ix++) {
       std::array<char, 32> valStr = highsDoubleToString(
           solution.col_dual[ix], kHighsSolutionValueToStringTolerance);
-      ss.str(std::string());
-      ss << "C" << ix;
-      const std::string name = have_col_names ? lp.col_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
+      if (!have_col_names)
+        snprintf(name_buf, sizeof(name_buf), "C%" HIGHSINT_FORMAT, ix);
+      const char* name = have_col_names ? lp.col_names_[ix].c_str() : name_buf;
+      fprintf(file, "%-s %s\n", name, valStr.data());
     }
     fprintf(file, "# Rows %" HIGHSINT_FORMAT "\n", lp.num_row_);
     for (HighsInt ix = 0; ix < lp.num_row_; ix++) {
       std::array<char, 32> valStr = highsDoubleToString(
           solution.row_dual[ix], kHighsSolutionValueToStringTolerance);
-      ss.str(std::string());
-      ss << "R" << ix;
-      const std::string name = have_row_names ? lp.row_names_[ix] : ss.str();
-      fprintf(file, "%-s %s\n", name.c_str(), valStr.data());
+      if (!have_row_names)
+        snprintf(name_buf, sizeof(name_buf), "R%" HIGHSINT_FORMAT, ix);
+      const char* name = have_row_names ? lp.row_names_[ix].c_str() : name_buf;
+      fprintf(file, "%-s %s\n", name, valStr.data());
     }
   }
 }
@@ -1023,63 +1027,49 @@ void writeOldRawSolution(FILE* file, const HighsLp& lp, const HighsBasis& basis,
   const bool have_value = solution.value_valid;
   const bool have_dual = solution.dual_valid;
   const bool have_basis = basis.valid;
-  vector<double> use_col_value;
-  vector<double> use_row_value;
-  vector<double> use_col_dual;
-  vector<double> use_row_dual;
-  vector<HighsBasisStatus> use_col_status;
-  vector<HighsBasisStatus> use_row_status;
-  if (have_value) {
-    use_col_value = solution.col_value;
-    use_row_value = solution.row_value;
-  }
-  if (have_dual) {
-    use_col_dual = solution.col_dual;
-    use_row_dual = solution.row_dual;
-  }
-  if (have_basis) {
-    use_col_status = basis.col_status;
-    use_row_status = basis.row_status;
-  }
+  // The solution and basis data are only read, so point at the
+  // originals rather than copying them: every access below is guarded
+  // by the corresponding have_* flag
+  const double* use_col_value = have_value ? solution.col_value.data() : nullptr;
+  const double* use_row_value = have_value ? solution.row_value.data() : nullptr;
+  const double* use_col_dual = have_dual ? solution.col_dual.data() : nullptr;
+  const double* use_row_dual = have_dual ? solution.row_dual.data() : nullptr;
+  const HighsBasisStatus* use_col_status =
+      have_basis ? basis.col_status.data() : nullptr;
+  const HighsBasisStatus* use_row_status =
+      have_basis ? basis.row_status.data() : nullptr;
   if (!have_value && !have_dual && !have_basis) return;
   fprintf(file,
           "%" HIGHSINT_FORMAT " %" HIGHSINT_FORMAT
           " : Number of columns and rows for primal or dual solution "
           "or basis\n",
           lp.num_col_, lp.num_row_);
-  if (have_value) {
-    fprintf(file, "T");
-  } else {
-    fprintf(file, "F");
-  }
-  fprintf(file, " Primal solution\n");
-  if (have_dual) {
-    fprintf(file, "T");
-  } else {
-    fprintf(file, "F");
-  }
-  fprintf(file, " Dual solution\n");
-  if (have_basis) {
-    fprintf(file, "T");
-  } else {
-    fprintf(file, "F");
-  }
-  fprintf(file, " Basis\n");
+  fprintf(file, "%c Primal solution\n", have_value ? 'T' : 'F');
+  fprintf(file, "%c Dual solution\n", have_dual ? 'T' : 'F');
+  fprintf(file, "%c Basis\n", have_basis ? 'T' : 'F');
+  // Assemble each line in a stack buffer and write it with a single
+  // fwrite: issuing 3-4 fprintf calls per entry pays stdio locking and
+  // format parsing per field
+  char line[96];
   fprintf(file, "Columns\n");
   for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
-    if (have_value) fprintf(file, "%.15g ", use_col_value[iCol]);
-    if (have_dual) fprintf(file, "%.15g ", use_col_dual[iCol]);
+    char* p = line;
+    if (have_value) p += sprintf(p, "%.15g ", use_col_value[iCol]);
+    if (have_dual) p += sprintf(p, "%.15g ", use_col_dual[iCol]);
     if (have_basis)
-      fprintf(file, "%" HIGHSINT_FORMAT "", (HighsInt)use_col_status[iCol]);
-    fprintf(file, "\n");
+      p += sprintf(p, "%" HIGHSINT_FORMAT "", (HighsInt)use_col_status[iCol]);
+    *p++ = '\n';
+    fwrite(line, 1, p - line, file);
   }
   fprintf(file, "Rows\n");
   for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-    if (have_value) fprintf(file, "%.15g ", use_row_value[iRow]);
-    if (have_dual) fprintf(file, "%.15g ", use_row_dual[iRow]);
+    char* p = line;
+    if (have_value) p += sprintf(p, "%.15g ", use_row_value[iRow]);
+    if (have_dual) p += sprintf(p, "%.15g ", use_row_dual[iRow]);
     if (have_basis)
-      fprintf(file, "%" HIGHSINT_FORMAT "", (HighsInt)use_row_status[iRow]);
-    fprintf(file, "\n");
+      p += sprintf(p, "%" HIGHSINT_FORMAT "", (HighsInt)use_row_status[iRow]);
+    *p++ = '\n';
+    fwrite(line, 1, p - line, file);
   }
 }
 
@@ -12,19 +12,15 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsPseudocost.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "mip/HighsMipSolverData.h"
 
 HighsPseudocost::HighsPseudocost(const HighsMipSolver& mipsolver)
-    : pseudocostup(mipsolver.numCol()),
-      pseudocostdown(mipsolver.numCol()),
-      nsamplesup(mipsolver.numCol()),
-      nsamplesdown(mipsolver.numCol()),
-      inferencesup(mipsolver.numCol()),
-      inferencesdown(mipsolver.numCol()),
-      ninferencesup(mipsolver.numCol()),
-      ninferencesdown(mipsolver.numCol()),
-      ncutoffsup(mipsolver.numCol()),
-      ncutoffsdown(mipsolver.numCol()),
+    : hot_entries(mipsolver.numCol()),
+      cold_entries(mipsolver.numCol()),
       conflictscoreup(mipsolver.numCol()),
       conflictscoredown(mipsolver.numCol()),
       conflict_weight(1.0),
@@ -48,32 +44,87 @@ HighsPseudocost::HighsPseudocost(const HighsMipSolver& mipsolver)
     for (HighsInt i = 0; i != mipsolver.numCol(); ++i) {
       HighsInt origCol = mipsolver.mipdata_->postSolveStack.getOrigColIndex(i);
 
-      pseudocostup[i] = mipsolver.pscostinit->pseudocostup[origCol];
-      nsamplesup[i] = mipsolver.pscostinit->nsamplesup[origCol];
-      pseudocostdown[i] = mipsolver.pscostinit->pseudocostdown[origCol];
-      nsamplesdown[i] = mipsolver.pscostinit->nsamplesdown[origCol];
-      inferencesup[i] = mipsolver.pscostinit->inferencesup[origCol];
-      ninferencesup[i] = mipsolver.pscostinit->ninferencesup[origCol];
-      inferencesdown[i] = mipsolver.pscostinit->inferencesdown[origCol];
-      ninferencesdown[i] = mipsolver.pscostinit->ninferencesdown[origCol];
+      hot_entries[i].pseudocostup =
+          mipsolver.pscostinit->pseudocostup[origCol];
+      hot_entries[i].nsamplesup = mipsolver.pscostinit->nsamplesup[origCol];
+      hot_entries[i].pseudocostdown =
+          mipsolver.pscostinit->pseudocostdown[origCol];
+      hot_entries[i].nsamplesdown = mipsolver.pscostinit->nsamplesdown[origCol];
+      cold_entries[i].inferencesup =
+          mipsolver.pscostinit->inferencesup[origCol];
+      cold_entries[i].ninferencesup =
+          mipsolver.pscostinit->ninferencesup[origCol];
+      cold_entries[i].inferencesdown =
+          mipsolver.pscostinit->inferencesdown[origCol];
+      cold_entries[i].ninferencesdown =
+          mipsolver.pscostinit->ninferencesdown[origCol];
       conflictscoreup[i] = mipsolver.pscostinit->conflictscoreup[origCol];
       conflictscoredown[i] = mipsolver.pscostinit->conflictscoredown[origCol];
     }
   }
+  inv_minreliable = minreliable > 0 ? 1.0 / minreliable : 0.0;
+  updateCostTotalRecip();
+  updateInferencesTotalRecip();
+  updateAvgCutoffRecip();
+  for (HighsInt i = 0; i != HighsInt(hot_entries.size()); ++i) {
+    updateCutoffRate(cold_entries[i], hot_entries[i], true);
+    updateCutoffRate(cold_entries[i], hot_entries[i], false);
+  }
+}
+
+void HighsPseudocost::subtractBase(const HighsPseudocost& base) {
+  HighsInt ncols = hot_entries.size();
+  PseudocostHotEntry* __restrict entry = hot_entries.data();
+  const PseudocostHotEntry* __restrict base_entry = base.hot_entries.data();
+#if defined(__AVX2__)
+  // One hot entry is a pair of floats followed by a pair of 32-bit
+  // sample counts, so each entry subtracts with one packed FP and one
+  // packed integer operation on its two 64-bit halves rather than four
+  // scalar ones
+  for (HighsInt i = 0; i != ncols; ++i) {
+    __m128 pseudocost =
+        _mm_sub_ps(_mm_castsi128_ps(_mm_loadl_epi64(
+                       reinterpret_cast<const __m128i*>(&entry[i].pseudocostup))),
+                   _mm_castsi128_ps(_mm_loadl_epi64(
+                       reinterpret_cast<const __m128i*>(
+                           &base_entry[i].pseudocostup))));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&entry[i].pseudocostup),
+                     _mm_castps_si128(pseudocost));
+    __m128i nsamples = _mm_sub_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&entry[i].nsamplesup)),
+        _mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(&base_entry[i].nsamplesup)));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&entry[i].nsamplesup),
+                     nsamples);
+  }
+#else
+  for (HighsInt i = 0; i != ncols; ++i) {
+    entry[i].pseudocostup -= base_entry[i].pseudocostup;
+    entry[i].pseudocostdown -= base_entry[i].pseudocostdown;
+    entry[i].nsamplesup -= base_entry[i].nsamplesup;
+    entry[i].nsamplesdown -= base_entry[i].nsamplesdown;
+  }
+#endif
+  // The sample counts feed the cached cutoff rates, so refresh them
+  // for the new counts
+  for (HighsInt i = 0; i != ncols; ++i) {
+    updateCutoffRate(cold_entries[i], hot_entries[i], true);
+    updateCutoffRate(cold_entries[i], hot_entries[i], false);
+  }
 }
 
 HighsPseudocostInitialization::HighsPseudocostInitialization(
     const HighsPseudocost& pscost, HighsInt maxCount)
-    : pseudocostup(pscost.pseudocostup),
-      pseudocostdown(pscost.pseudocostdown),
-      nsamplesup(pscost.nsamplesup),
-      nsamplesdown(pscost.nsamplesdown),
-      inferencesup(pscost.inferencesup),
-      inferencesdown(pscost.inferencesdown),
-      ninferencesup(pscost.ninferencesup),
-      ninferencesdown(pscost.ninferencesdown),
-      conflictscoreup(pscost.conflictscoreup.size()),
-      conflictscoredown(pscost.conflictscoreup.size()),
+    : pseudocostup(pscost.hot_entries.size()),
+      pseudocostdown(pscost.hot_entries.size()),
+      nsamplesup(pscost.hot_entries.size()),
+      nsamplesdown(pscost.hot_entries.size()),
+      inferencesup(pscost.hot_entries.size()),
+      inferencesdown(pscost.hot_entries.size()),
+      ninferencesup(pscost.hot_entries.size()),
+      ninferencesdown(pscost.hot_entries.size()),
+      conflictscoreup(pscost.hot_entries.size()),
+      conflictscoredown(pscost.hot_entries.size()),
       cost_total(pscost.cost_total),
       inferences_total(pscost.inferences_total),
       conflict_avg_score(pscost.conflict_avg_score),
@@ -82,10 +133,18 @@ HighsPseudocostInitialization::HighsPseudocostInitialization(
   HighsInt ncol = pseudocostup.size();
   conflict_avg_score /= ncol * pscost.conflict_weight;
   for (HighsInt i = 0; i != ncol; ++i) {
-    nsamplesup[i] = std::min(nsamplesup[i], maxCount);
-    nsamplesdown[i] = std::min(nsamplesdown[i], maxCount);
-    ninferencesup[i] = std::min(ninferencesup[i], HighsInt{1});
-    ninferencesdown[i] = std::min(ninferencesdown[i], HighsInt{1});
+    pseudocostup[i] = pscost.hot_entries[i].pseudocostup;
+    pseudocostdown[i] = pscost.hot_entries[i].pseudocostdown;
+    nsamplesup[i] =
+        std::min<HighsInt>(pscost.hot_entries[i].nsamplesup, maxCount);
+    nsamplesdown[i] =
+        std::min<HighsInt>(pscost.hot_entries[i].nsamplesdown, maxCount);
+    inferencesup[i] = pscost.cold_entries[i].inferencesup;
+    inferencesdown[i] = pscost.cold_entries[i].inferencesdown;
+    ninferencesup[i] =
+        std::min<HighsInt>(pscost.cold_entries[i].ninferencesup, 1);
+    ninferencesdown[i] =
+        std::min<HighsInt>(pscost.cold_entries[i].ninferencesdown, 1);
     conflictscoreup[i] = pscost.conflictscoreup[i] / pscost.conflict_weight;
     conflictscoredown[i] = pscost.conflictscoredown[i] / pscost.conflict_weight;
   }
@@ -110,20 +169,22 @@ HighsPseudocostInitialization::HighsPseudocostInitialization(
   conflictscoreup.resize(postsolveStack.getOrigNumCol());
   conflictscoredown.resize(postsolveStack.getOrigNumCol());
 
-  HighsInt ncols = pscost.pseudocostup.size();
+  HighsInt ncols = pscost.hot_entries.size();
   conflict_avg_score /= ncols * pscost.conflict_weight;
 
   for (HighsInt i = 0; i != ncols; ++i) {
-    pseudocostup[postsolveStack.getOrigColIndex(i)] = pscost.pseudocostup[i];
+    pseudocostup[postsolveStack.getOrigColIndex(i)] =
+        pscost.hot_entries[i].pseudocostup;
     pseudocostdown[postsolveStack.getOrigColIndex(i)] =
-        pscost.pseudocostdown[i];
+        pscost.hot_entries[i].pseudocostdown;
     nsamplesup[postsolveStack.getOrigColIndex(i)] =
-        std::min(maxCount, pscost.nsamplesup[i]);
+        std::min<HighsInt>(maxCount, pscost.hot_entries[i].nsamplesup);
     nsamplesdown[postsolveStack.getOrigColIndex(i)] =
-        std::min(maxCount, pscost.nsamplesdown[i]);
-    inferencesup[postsolveStack.getOrigColIndex(i)] = pscost.inferencesup[i];
+        std::min<HighsInt>(maxCount, pscost.hot_entries[i].nsamplesdown);
+    inferencesup[postsolveStack.getOrigColIndex(i)] =
+        pscost.cold_entries[i].inferencesup;
     inferencesdown[postsolveStack.getOrigColIndex(i)] =
-        pscost.inferencesdown[i];
+        pscost.cold_entries[i].inferencesdown;
     ninferencesup[postsolveStack.getOrigColIndex(i)] = 1;
     ninferencesdown[postsolveStack.getOrigColIndex(i)] = 1;
     conflictscoreup[postsolveStack.getOrigColIndex(i)] =
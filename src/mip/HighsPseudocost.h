@@ -54,16 +54,41 @@ struct HighsPseudocostInitialization {
 };
 class HighsPseudocost {
   friend struct HighsPseudocostInitialization;
-  std::vector<double> pseudocostup;
-  std::vector<double> pseudocostdown;
-  std::vector<HighsInt> nsamplesup;
-  std::vector<HighsInt> nsamplesdown;
-  std::vector<double> inferencesup;
-  std::vector<double> inferencesdown;
-  std::vector<HighsInt> ninferencesup;
-  std::vector<HighsInt> ninferencesdown;
-  std::vector<HighsInt> ncutoffsup;
-  std::vector<HighsInt> ncutoffsdown;
+  // Per-column branching statistics, split into a hot group - the
+  // pseudocosts and sample counts that getPseudocostUp/Down read for
+  // every fractional candidate at every branching decision - and a
+  // cold group of inference and cutoff statistics that only the full
+  // getScore and the observation updates touch. The running means are
+  // stored as float - they feed a heuristic ranking, so seven
+  // significant digits are ample - which keeps a hot entry at 16
+  // bytes per column; the updates still accumulate in double before
+  // narrowing
+  // The counters are int32_t rather than HighsInt so the entries keep
+  // their size on 64-bit index builds: per-column observation counts
+  // stay far below 2^31 in practice
+  struct PseudocostHotEntry {
+    float pseudocostup = 0.0f;
+    float pseudocostdown = 0.0f;
+    int32_t nsamplesup = 0;
+    int32_t nsamplesdown = 0;
+  };
+  struct PseudocostColdEntry {
+    float inferencesup = 0.0f;
+    float inferencesdown = 0.0f;
+    // Cutoff rates ncutoffs / max(1, ncutoffs + nsamples), maintained
+    // where the counts change so getScore loads them instead of
+    // dividing
+    float cutoffrateup = 0.0f;
+    float cutoffratedown = 0.0f;
+    int32_t ninferencesup = 0;
+    int32_t ninferencesdown = 0;
+    int32_t ncutoffsup = 0;
+    int32_t ncutoffsdown = 0;
+  };
+  std::vector<PseudocostHotEntry> hot_entries;
+  std::vector<PseudocostColdEntry> cold_entries;
+  // The conflict scores stay as separate arrays: they are rescaled in
+  // bulk by increaseConflictWeight, which streams them contiguously
   std::vector<double> conflictscoreup;
   std::vector<double> conflictscoredown;
 
@@ -76,21 +101,52 @@ class HighsPseudocost {
   int64_t ncutoffstotal;
   HighsInt minreliable;
   double degeneracyFactor;
+  // Cached reciprocals of the score denominators, refreshed where the
+  // corresponding totals change, so each of the many score evaluations
+  // per branching decision multiplies instead of divides
+  double inv_minreliable;
+  double inv_cost_total;
+  double inv_cost_total_sq;
+  double inv_inferences_total;
+  double inv_inferences_total_sq;
+  double inv_avg_cutoff;
+  double inv_avg_cutoff_sq;
+
+  void updateCostTotalRecip() {
+    inv_cost_total = 1.0 / std::max(1e-6, cost_total);
+    inv_cost_total_sq = 1.0 / std::max(1e-6, cost_total * cost_total);
+  }
+
+  void updateInferencesTotalRecip() {
+    inv_inferences_total = 1.0 / std::max(1e-6, inferences_total);
+    inv_inferences_total_sq =
+        1.0 / std::max(1e-6, inferences_total * inferences_total);
+  }
+
+  void updateAvgCutoffRecip() {
+    double avg_cutoff =
+        ncutoffstotal / std::max(1.0, double(ncutoffstotal + nsamplestotal));
+    inv_avg_cutoff = 1.0 / std::max(1e-6, avg_cutoff);
+    inv_avg_cutoff_sq = 1.0 / std::max(1e-6, avg_cutoff * avg_cutoff);
+  }
+
+  void updateCutoffRate(PseudocostColdEntry& cold,
+                        const PseudocostHotEntry& hot, bool upbranch) {
+    if (upbranch)
+      cold.cutoffrateup =
+          cold.ncutoffsup /
+          std::max(1.0, double(cold.ncutoffsup + hot.nsamplesup));
+    else
+      cold.cutoffratedown =
+          cold.ncutoffsdown /
+          std::max(1.0, double(cold.ncutoffsdown + hot.nsamplesdown));
+  }
 
  public:
   HighsPseudocost() = default;
   HighsPseudocost(const HighsMipSolver& mipsolver);
 
-  void subtractBase(const HighsPseudocost& base) {
-    HighsInt ncols = pseudocostup.size();
-
-    for (HighsInt i = 0; i != ncols; ++i) {
-      pseudocostup[i] -= base.pseudocostup[i];
-      pseudocostdown[i] -= base.pseudocostdown[i];
-      nsamplesup[i] -= base.nsamplesup[i];
-      nsamplesdown[i] -= base.nsamplesdown[i];
-    }
-  }
+  void subtractBase(const HighsPseudocost& base);
 
   void increaseConflictWeight() {
     conflict_weight *= 1.02;
@@ -123,50 +179,62 @@ class HighsPseudocost {
     conflict_avg_score += conflict_weight;
   }
 
-  void setMinReliable(HighsInt minreliable) { this->minreliable = minreliable; }
+  void setMinReliable(HighsInt minreliable) {
+    this->minreliable = minreliable;
+    inv_minreliable = minreliable > 0 ? 1.0 / minreliable : 0.0;
+  }
 
   HighsInt getMinReliable() const { return minreliable; }
 
   HighsInt getNumObservations(HighsInt col) const {
-    return nsamplesup[col] + nsamplesdown[col];
+    return hot_entries[col].nsamplesup + hot_entries[col].nsamplesdown;
   }
 
-  HighsInt getNumObservationsUp(HighsInt col) const { return nsamplesup[col]; }
+  HighsInt getNumObservationsUp(HighsInt col) const {
+    return hot_entries[col].nsamplesup;
+  }
 
   HighsInt getNumObservationsDown(HighsInt col) const {
-    return nsamplesdown[col];
+    return hot_entries[col].nsamplesdown;
   }
 
   void addCutoffObservation(HighsInt col, bool upbranch) {
     ++ncutoffstotal;
     if (upbranch)
-      ncutoffsup[col] += 1;
+      cold_entries[col].ncutoffsup += 1;
     else
-      ncutoffsdown[col] += 1;
+      cold_entries[col].ncutoffsdown += 1;
+    updateCutoffRate(cold_entries[col], hot_entries[col], upbranch);
+    updateAvgCutoffRecip();
   }
 
   void addObservation(HighsInt col, double delta, double objdelta) {
     assert(delta != 0.0);
     assert(objdelta >= 0.0);
-    if (delta > 0.0) {
-      double unit_gain = objdelta / delta;
-      double d = unit_gain - pseudocostup[col];
-      nsamplesup[col] += 1;
-      pseudocostup[col] += d / nsamplesup[col];
-
-      d = unit_gain - cost_total;
-      ++nsamplestotal;
-      cost_total += d / nsamplestotal;
-    } else {
-      double unit_gain = -objdelta / delta;
-      double d = unit_gain - pseudocostdown[col];
-      nsamplesdown[col] += 1;
-      pseudocostdown[col] += d / nsamplesdown[col];
-
-      d = unit_gain - cost_total;
-      ++nsamplestotal;
-      cost_total += d / nsamplestotal;
-    }
+    PseudocostHotEntry& entry = hot_entries[col];
+    // The branch direction is data-dependent and mispredicts often, so
+    // select the up/down pair branchlessly: the unit gain is
+    // objdelta/|delta| either way, and the ternaries reduce to address
+    // selects rather than a conditional jump
+    const bool upbranch = delta > 0.0;
+    double unit_gain = std::fabs(objdelta / delta);
+    float& pseudocost = upbranch ? entry.pseudocostup : entry.pseudocostdown;
+    int32_t& nsamples = upbranch ? entry.nsamplesup : entry.nsamplesdown;
+    // Compute the new count and mean in registers before storing, so
+    // the mean update does not reload the count it just stored
+    const int32_t new_nsamples = nsamples + 1;
+    const double mean = pseudocost;
+    nsamples = new_nsamples;
+    pseudocost = mean + (unit_gain - mean) / new_nsamples;
+
+    double d = unit_gain - cost_total;
+    ++nsamplestotal;
+    cost_total += d / nsamplestotal;
+    updateCostTotalRecip();
+    // The new sample also shifts this column's cutoff rate and the
+    // average cutoff rate
+    updateCutoffRate(cold_entries[col], entry, upbranch);
+    updateAvgCutoffRecip();
   }
 
   void addInferenceObservation(HighsInt col, HighsInt ninferences,
@@ -174,27 +242,30 @@ class HighsPseudocost {
     double d = ninferences - inferences_total;
     ++ninferencestotal;
     inferences_total += d / ninferencestotal;
+    updateInferencesTotalRecip();
+    PseudocostColdEntry& entry = cold_entries[col];
     if (upbranch) {
-      d = ninferences - inferencesup[col];
-      ninferencesup[col] += 1;
-      inferencesup[col] += d / ninferencesup[col];
+      d = ninferences - entry.inferencesup;
+      entry.ninferencesup += 1;
+      entry.inferencesup += d / entry.ninferencesup;
     } else {
-      d = ninferences - inferencesdown[col];
-      ninferencesdown[col] += 1;
-      inferencesdown[col] += d / ninferencesdown[col];
+      d = ninferences - entry.inferencesdown;
+      entry.ninferencesdown += 1;
+      entry.inferencesdown += d / entry.ninferencesdown;
     }
   }
 
   bool isReliable(HighsInt col) const {
-    return std::min(nsamplesup[col], nsamplesdown[col]) >= minreliable;
+    return std::min(hot_entries[col].nsamplesup,
+                    hot_entries[col].nsamplesdown) >= minreliable;
   }
 
   bool isReliableUp(HighsInt col) const {
-    return nsamplesup[col] >= minreliable;
+    return hot_entries[col].nsamplesup >= minreliable;
   }
 
   bool isReliableDown(HighsInt col) const {
-    return nsamplesdown[col] >= minreliable;
+    return hot_entries[col].nsamplesdown >= minreliable;
   }
 
   double getAvgPseudocost() const { return cost_total; }
@@ -203,14 +274,16 @@ class HighsPseudocost {
     double up = std::ceil(frac) - frac;
     double cost;
 
-    if (nsamplesup[col] == 0 || nsamplesup[col] < minreliable) {
-      double weightPs = nsamplesup[col] == 0
-                            ? 0
-                            : 0.9 + 0.1 * nsamplesup[col] / (double)minreliable;
-      cost = weightPs * pseudocostup[col];
+    const PseudocostHotEntry& entry = hot_entries[col];
+    if (entry.nsamplesup == 0 || entry.nsamplesup < minreliable) {
+      double weightPs =
+          entry.nsamplesup == 0
+              ? 0
+              : 0.9 + 0.1 * entry.nsamplesup * inv_minreliable;
+      cost = weightPs * entry.pseudocostup;
       cost += (1.0 - weightPs) * getAvgPseudocost();
     } else
-      cost = pseudocostup[col];
+      cost = entry.pseudocostup;
     return up * (offset + cost);
   }
 
@@ -218,28 +291,41 @@ class HighsPseudocost {
     double down = frac - std::floor(frac);
     double cost;
 
-    if (nsamplesdown[col] == 0 || nsamplesdown[col] < minreliable) {
-      double weightPs = nsamplesdown[col] == 0 ? 0
-                                               : 0.9 + 0.1 * nsamplesdown[col] /
-                                                           (double)minreliable;
-      cost = weightPs * pseudocostdown[col];
+    const PseudocostHotEntry& entry = hot_entries[col];
+    if (entry.nsamplesdown == 0 || entry.nsamplesdown < minreliable) {
+      double weightPs =
+          entry.nsamplesdown == 0
+              ? 0
+              : 0.9 + 0.1 * entry.nsamplesdown * inv_minreliable;
+      cost = weightPs * entry.pseudocostdown;
       cost += (1.0 - weightPs) * getAvgPseudocost();
     } else
-      cost = pseudocostdown[col];
+      cost = entry.pseudocostdown;
 
     return down * (offset + cost);
   }
 
+  // Variants taking the already-computed distance to the integer
+  // above/below. frac is an absolute column value, so the two
+  // distances cannot collapse to constants, but they are complementary
+  // for a fractional value: callers needing both pay for one floor
+  // instead of a floor and a ceil
+  double getPseudocostUpFromFraction(HighsInt col, double up) const {
+    if (hot_entries[col].nsamplesup == 0) return up * cost_total;
+    return up * hot_entries[col].pseudocostup;
+  }
+
+  double getPseudocostDownFromFraction(HighsInt col, double down) const {
+    if (hot_entries[col].nsamplesdown == 0) return down * cost_total;
+    return down * hot_entries[col].pseudocostdown;
+  }
+
   double getPseudocostUp(HighsInt col, double frac) const {
-    double up = std::ceil(frac) - frac;
-    if (nsamplesup[col] == 0) return up * cost_total;
-    return up * pseudocostup[col];
+    return getPseudocostUpFromFraction(col, std::ceil(frac) - frac);
   }
 
   double getPseudocostDown(HighsInt col, double frac) const {
-    double down = frac - std::floor(frac);
-    if (nsamplesdown[col] == 0) return down * cost_total;
-    return down * pseudocostdown[col];
+    return getPseudocostDownFromFraction(col, frac - std::floor(frac));
   }
 
   double getConflictScoreUp(HighsInt col) const {
@@ -251,24 +337,16 @@ class HighsPseudocost {
   }
 
   double getScore(HighsInt col, double upcost, double downcost) const {
-    double costScore = std::max(upcost, 1e-6) * std::max(downcost, 1e-6) /
-                       std::max(1e-6, cost_total * cost_total);
-    double inferenceScore = std::max(inferencesup[col], 1e-6) *
-                            std::max(inferencesdown[col], 1e-6) /
-                            std::max(1e-6, inferences_total * inferences_total);
-
-    double cutOffScoreUp =
-        ncutoffsup[col] /
-        std::max(1.0, double(ncutoffsup[col] + nsamplesup[col]));
-    double cutOffScoreDown =
-        ncutoffsdown[col] /
-        std::max(1.0, double(ncutoffsdown[col] + nsamplesdown[col]));
-    double avgCutoffs =
-        ncutoffstotal / std::max(1.0, double(ncutoffstotal + nsamplestotal));
+    const PseudocostColdEntry& cold = cold_entries[col];
+    double costScore =
+        std::max(upcost, 1e-6) * std::max(downcost, 1e-6) * inv_cost_total_sq;
+    double inferenceScore = std::max(double(cold.inferencesup), 1e-6) *
+                            std::max(double(cold.inferencesdown), 1e-6) *
+                            inv_inferences_total_sq;
 
-    double cutoffScore = std::max(cutOffScoreUp, 1e-6) *
-                         std::max(cutOffScoreDown, 1e-6) /
-                         std::max(1e-6, avgCutoffs * avgCutoffs);
+    double cutoffScore = std::max(double(cold.cutoffrateup), 1e-6) *
+                         std::max(double(cold.cutoffratedown), 1e-6) *
+                         inv_avg_cutoff_sq;
 
     double conflictScoreUp = conflictscoreup[col] / conflict_weight;
     double conflictScoreDown = conflictscoredown[col] / conflict_weight;
@@ -285,25 +363,34 @@ class HighsPseudocost {
                 1e-4 * (mapScore(cutoffScore) + mapScore(inferenceScore)));
   }
 
+  // Fused form of the two pseudocost reads above: one load of the hot
+  // entry serves both directions, and the cost_total fallback is
+  // shared rather than re-read per direction
+  void getPseudocostUpDown(HighsInt col, double frac, double& upcost,
+                           double& downcost) const {
+    const PseudocostHotEntry& entry = hot_entries[col];
+    double down = frac - std::floor(frac);
+    double up = 1.0 - down;
+    upcost =
+        up * (entry.nsamplesup == 0 ? cost_total : double(entry.pseudocostup));
+    downcost = down * (entry.nsamplesdown == 0 ? cost_total
+                                               : double(entry.pseudocostdown));
+  }
+
   double getScore(HighsInt col, double frac) const {
-    double upcost = getPseudocostUp(col, frac);
-    double downcost = getPseudocostDown(col, frac);
+    double upcost;
+    double downcost;
+    getPseudocostUpDown(col, frac, upcost, downcost);
 
     return getScore(col, upcost, downcost);
   }
 
   double getScoreUp(HighsInt col, double frac) const {
-    double costScore = getPseudocostUp(col, frac) / std::max(1e-6, cost_total);
-    double inferenceScore =
-        inferencesup[col] / std::max(1e-6, inferences_total);
-
-    double cutOffScoreUp =
-        ncutoffsup[col] /
-        std::max(1.0, double(ncutoffsup[col] + nsamplesup[col]));
-    double avgCutoffs =
-        ncutoffstotal / std::max(1.0, double(ncutoffstotal + nsamplestotal));
+    const PseudocostColdEntry& cold = cold_entries[col];
+    double costScore = getPseudocostUp(col, frac) * inv_cost_total;
+    double inferenceScore = cold.inferencesup * inv_inferences_total;
 
-    double cutoffScore = cutOffScoreUp / std::max(1e-6, avgCutoffs);
+    double cutoffScore = cold.cutoffrateup * inv_avg_cutoff;
 
     double conflictScoreUp = conflictscoreup[col] / conflict_weight;
     double conflictScoreAvg =
@@ -318,18 +405,11 @@ class HighsPseudocost {
   }
 
   double getScoreDown(HighsInt col, double frac) const {
-    double costScore =
-        getPseudocostDown(col, frac) / std::max(1e-6, cost_total);
-    double inferenceScore =
-        inferencesdown[col] / std::max(1e-6, inferences_total);
-
-    double cutOffScoreDown =
-        ncutoffsdown[col] /
-        std::max(1.0, double(ncutoffsdown[col] + nsamplesdown[col]));
-    double avgCutoffs =
-        ncutoffstotal / std::max(1.0, double(ncutoffstotal + nsamplestotal));
+    const PseudocostColdEntry& cold = cold_entries[col];
+    double costScore = getPseudocostDown(col, frac) * inv_cost_total;
+    double inferenceScore = cold.inferencesdown * inv_inferences_total;
 
-    double cutoffScore = cutOffScoreDown / std::max(1e-6, avgCutoffs);
+    double cutoffScore = cold.cutoffratedown * inv_avg_cutoff;
 
     double conflictScoreDown = conflictscoredown[col] / conflict_weight;
     double conflictScoreAvg =
@@ -343,10 +423,12 @@ class HighsPseudocost {
             1e-4 * (mapScore(cutoffScore) + mapScore(inferenceScore)));
   }
 
-  double getAvgInferencesUp(HighsInt col) const { return inferencesup[col]; }
+  double getAvgInferencesUp(HighsInt col) const {
+    return cold_entries[col].inferencesup;
+  }
 
   double getAvgInferencesDown(HighsInt col) const {
-    return inferencesdown[col];
+    return cold_entries[col].inferencesdown;
   }
 };
 
@@ -16,6 +16,10 @@
 
 #include "presolve/PresolveComponent.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "presolve/HPresolve.h"
 
 HighsStatus PresolveComponent::init(const HighsLp& lp, HighsTimer& timer,
@@ -60,13 +64,21 @@ std::string PresolveComponent::presolveStatusToString(
 }
 
 void PresolveComponent::negateReducedLpColDuals(bool reduced) {
-  for (HighsInt col = 0; col < data_.reduced_lp_.num_col_; col++)
-    data_.recovered_solution_.col_dual[col] =
-        -data_.recovered_solution_.col_dual[col];
-  return;
+  double* col_dual = data_.recovered_solution_.col_dual.data();
+  const HighsInt num_col = data_.reduced_lp_.num_col_;
+  HighsInt col = 0;
+#if defined(__AVX2__)
+  // Negating an IEEE double is an XOR of its sign bit, so flip four
+  // duals per step, with the scalar loop taking the tail
+  const __m256d sign_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(int64_t(0x8000000000000000ULL)));
+  for (; col + 4 <= num_col; col += 4)
+    _mm256_storeu_pd(col_dual + col,
+                     _mm256_xor_pd(_mm256_loadu_pd(col_dual + col), sign_mask));
+#endif
+  for (; col < num_col; col++) col_dual[col] = -col_dual[col];
 }
 
-void PresolveComponent::negateReducedLpCost() { return; }
 
 HighsPresolveStatus PresolveComponent::run() {
   presolve::HPresolve presolve;
@@ -108,16 +120,9 @@ bool checkOptions(const PresolveComponentOptions& options) {
   // todo: check options in a smart way
   if (options.dev) std::cout << "Checking presolve options... ";
 
-  if (!(options.iteration_strategy == "smart" ||
-        options.iteration_strategy == "off" ||
-        options.iteration_strategy == "num_limit")) {
-    if (options.dev)
-      std::cout << "error: iteration strategy unknown: "
-                << options.iteration_strategy << "." << std::endl;
-    return false;
-  }
-
-  if (options.iteration_strategy == "num_limit" && options.max_iterations < 0) {
+  if (options.iteration_strategy ==
+          PresolveComponentOptions::IterationStrategy::kNumLimit &&
+      options.max_iterations < 0) {
     if (options.dev)
       std::cout << "warning: negative iteration limit: "
                 << options.max_iterations
@@ -84,7 +84,10 @@ struct PresolveComponentOptions : public HighsComponentOptions {
   bool is_valid = false;
   // presolve options later when needed.
 
-  std::string iteration_strategy = "smart";
+  // Parsed once rather than held as a string, so consumers switch on
+  // the value instead of re-comparing option names
+  enum class IterationStrategy { kSmart, kOff, kNumLimit };
+  IterationStrategy iteration_strategy = IterationStrategy::kSmart;
   HighsInt max_iterations = 0;
 
   double time_limit = -1;
@@ -108,7 +111,6 @@ class PresolveComponent : public HighsComponent {
   std::string presolveStatusToString(const HighsPresolveStatus presolve_status);
 
   void negateReducedLpColDuals(bool reduced);
-  void negateReducedLpCost();
 
   //  bool has_run_ = false;
 
@@ -0,0 +1,92 @@
+#ifndef __SRC_LIB_ALIGNEDALLOCATOR_HPP__
+#define __SRC_LIB_ALIGNEDALLOCATOR_HPP__
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// minimal C++11 allocator handing out storage aligned to A bytes, so
+// the SIMD kernels can rely on full-cache-line-aligned double arrays
+// (32B for AVX2, 64B for AVX-512) without paying split-load penalties
+template <class T, std::size_t A = 64>
+struct AlignedAllocator {
+  typedef T value_type;
+
+  AlignedAllocator() = default;
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, A>&) {}
+
+  template <class U>
+  struct rebind {
+    typedef AlignedAllocator<U, A> other;
+  };
+
+  T* allocate(std::size_t n) {
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(n * sizeof(T), A);
+    if (!ptr) throw std::bad_alloc();
+#else
+    if (posix_memalign(&ptr, A, n * sizeof(T))) throw std::bad_alloc();
+#endif
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* p, std::size_t) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+  }
+};
+
+template <class T, class U, std::size_t A>
+bool operator==(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) {
+  return true;
+}
+template <class T, class U, std::size_t A>
+bool operator!=(const AlignedAllocator<T, A>&, const AlignedAllocator<U, A>&) {
+  return false;
+}
+
+// 64-byte-aligned double vector used for the hot numeric arrays
+using DVec = std::vector<double, AlignedAllocator<double>>;
+
+// variant whose default construct() is a no-op, so resize() skips the
+// zero-fill. Only suitable for scratch arrays whose contract is that
+// entries are written before being read (index[] tails).
+template <class T, std::size_t A = 64>
+struct UninitAlignedAllocator : AlignedAllocator<T, A> {
+  typedef T value_type;
+
+  UninitAlignedAllocator() = default;
+  template <class U>
+  UninitAlignedAllocator(const UninitAlignedAllocator<U, A>&) {}
+
+  template <class U>
+  struct rebind {
+    typedef UninitAlignedAllocator<U, A> other;
+  };
+
+  template <class U>
+  void construct(U* p) {
+    ::new (static_cast<void*>(p)) U;
+  }
+  template <class U, class... Args>
+  void construct(U* p, Args&&... args) {
+    ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+  }
+};
+
+// scratch vectors sized dim whose contents are only meaningful below
+// num_nz; constructing them must not cost a dim-sized zero-fill
+using DVecUninit = std::vector<double, UninitAlignedAllocator<double>>;
+
+#endif
@@ -259,6 +259,7 @@ Vector Basis::recomputex(const Instance& inst) {
     }
 
     rhs.index[i] = i;
+    rhs.in_pattern[i] = 1;
     rhs.num_nz++;
   }
   HVector rhs_hvec = vec2hvec(rhs);
@@ -289,6 +290,7 @@ Vector& Basis::Zprod(const Vector& rhs, Vector& target) {
     HighsInt idx = constraintindexinbasisfactor[nonactive];
     temp.index[i] = idx;
     temp.value[idx] = rhs.value[nz];
+    temp.in_pattern[idx] = 1;
   }
   temp.num_nz = rhs.num_nz;
   return btran(temp, target);
@@ -41,6 +41,7 @@ class Basis {
     for (HighsInt i = 0; i < hvec.count; i++) {
       target.index[i] = hvec.index[i];
       target.value[target.index[i]] = hvec.array[hvec.index[i]];
+      target.in_pattern[target.index[i]] = 1;
     }
     // for (HighsInt i = 0; i < hvec.size; i++) {
     //   target.index[i] = hvec.index[i];
@@ -23,10 +23,14 @@ static void computestartingpoint_highs(Runtime& runtime, CrashSolution& result)
   lp.a_matrix_.format_ = MatrixFormat::kColwise;
   lp.col_cost_.assign(runtime.instance.num_var, 0.0);
   // lp.col_cost_ = runtime.instance.c.value;
-  lp.col_lower_ = runtime.instance.var_lo;
-  lp.col_upper_ = runtime.instance.var_up;
-  lp.row_lower_ = runtime.instance.con_lo;
-  lp.row_upper_ = runtime.instance.con_up;
+  lp.col_lower_.assign(runtime.instance.var_lo.begin(),
+                       runtime.instance.var_lo.end());
+  lp.col_upper_.assign(runtime.instance.var_up.begin(),
+                       runtime.instance.var_up.end());
+  lp.row_lower_.assign(runtime.instance.con_lo.begin(),
+                       runtime.instance.con_lo.end());
+  lp.row_upper_.assign(runtime.instance.con_up.begin(),
+                       runtime.instance.con_up.end());
   lp.num_col_ = runtime.instance.num_var;
   lp.num_row_ = runtime.instance.num_con;
 
@@ -90,6 +94,7 @@ static void computestartingpoint_highs(Runtime& runtime, CrashSolution& result)
   for (HighsInt i = 0; i < x0.dim; i++) {
     if (fabs(sol.col_value[i]) > 10E-5) {
       x0.value[i] = sol.col_value[i];
+      x0.in_pattern[i] = 1;
       x0.index[x0.num_nz++] = i;
     }
   }
@@ -97,6 +102,7 @@ static void computestartingpoint_highs(Runtime& runtime, CrashSolution& result)
   for (HighsInt i = 0; i < ra.dim; i++) {
     if (fabs(sol.row_value[i]) > 10E-5) {
       ra.value[i] = sol.row_value[i];
+      ra.in_pattern[i] = 1;
       ra.index[ra.num_nz++] = i;
     }
   }
@@ -12,7 +12,7 @@ class Gradient {
   HighsInt numupdates = 0;
 
   void recompute() {
-    runtime.instance.Q.vec_mat(runtime.primal, gradient);
+    runtime.instance.Q.blocked().vec_mat(runtime.primal, gradient);
     gradient += runtime.instance.c;
     uptodate = true;
     numupdates = 0;
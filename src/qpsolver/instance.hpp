@@ -4,59 +4,112 @@
 #include <vector>
 
 #include "matrix.hpp"
+#include "util/HighsBitUtils.h"
 #include "vector.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 struct SumNum {
   double sum = 0.0;
   HighsInt num = 0;
 };
 
-struct Instance {
+// templated on the matrix representation so the vec_mat/mat_vec kernels
+// resolve statically and inline into the objective and infeasibility
+// code below; Instance aliases the default CSC Matrix storage
+template <class MatT>
+struct InstanceT {
   HighsInt num_var = 0;
   HighsInt num_con = 0;
   double offset = 0;
   Vector c;
-  Matrix Q;
-  std::vector<double> con_lo;
-  std::vector<double> con_up;
-  Matrix A;
-  std::vector<double> var_lo;
-  std::vector<double> var_up;
-
-  Instance(HighsInt nv = 0, HighsInt nc = 0)
+  MatT Q;
+  DVec con_lo;
+  DVec con_up;
+  MatT A;
+  DVec var_lo;
+  DVec var_up;
+
+  InstanceT(HighsInt nv = 0, HighsInt nc = 0)
       : num_var(nv),
         num_con(nc),
         c(Vector(nv)),
-        Q(Matrix(nv, nv)),
-        A(Matrix(nc, nv)) {}
+        Q(MatT(nv, nv)),
+        A(MatT(nc, nv)) {}
+
+  double objval(const Vector& x) { return objval_fused(x); }
 
-  double objval(const Vector& x) {
-    return c * x + 0.5 * (Q.vec_mat(x) * x) + offset;
+  // single pass over the columns of Q computing
+  // sum_i x_i * (c_i + 0.5 * sum_j Q_ij x_j) + offset: the intermediate
+  // Q*x is never materialized, saving a Vector allocation and a second
+  // sweep over its entries per objective evaluation
+  double objval_fused(const Vector& x) {
+    double result = offset;
+    for (HighsInt col = 0; col < num_var; col++) {
+      const double xval = x.value[col];
+      if (xval == 0.0) continue;
+      double qdot = 0.0;
+      for (HighsInt idx = Q.mat.start[col]; idx < Q.mat.start[col + 1];
+           idx++) {
+        qdot += Q.mat.value[idx] * x.value[Q.mat.index[idx]];
+      }
+      result += xval * (c.value[col] + 0.5 * qdot);
+    }
+    return result;
   }
 
   SumNum sumnumprimalinfeasibilities(const Vector& x,
                                      const Vector& rowactivity) {
     SumNum res;
-    for (HighsInt row = 0; row < num_con; row++) {
-      if (rowactivity.value[row] < con_lo[row]) {
-        res.sum += (con_lo[row] - rowactivity.value[row]);
-        res.num++;
-      } else if (rowactivity.value[row] > con_up[row]) {
-        res.sum += (rowactivity.value[row] - con_up[row]);
-        res.num++;
-      }
+    sumnuminfeasibilities(rowactivity.value.data(), con_lo.data(),
+                          con_up.data(), num_con, res);
+    sumnuminfeasibilities(x.value.data(), var_lo.data(), var_up.data(),
+                          num_var, res);
+    return res;
+  }
+
+ private:
+  // accumulates the bound violations of values[0..count) into res. On
+  // AVX2 builds the loop is branchless: compare masks select the
+  // violation amounts and a popcount of the mask bits counts them.
+  static void sumnuminfeasibilities(const double* values, const double* lo,
+                                    const double* up, HighsInt count,
+                                    SumNum& res) {
+    HighsInt i = 0;
+#if defined(__AVX2__)
+    __m256d sum_acc = _mm256_setzero_pd();
+    const __m256d zero = _mm256_setzero_pd();
+    for (; i + 4 <= count; i += 4) {
+      __m256d val = _mm256_loadu_pd(&values[i]);
+      __m256d lo_viol = _mm256_max_pd(
+          _mm256_sub_pd(_mm256_loadu_pd(&lo[i]), val), zero);
+      __m256d up_viol = _mm256_max_pd(
+          _mm256_sub_pd(val, _mm256_loadu_pd(&up[i])), zero);
+      sum_acc = _mm256_add_pd(sum_acc, _mm256_add_pd(lo_viol, up_viol));
+      __m256d violated = _mm256_or_pd(_mm256_cmp_pd(lo_viol, zero, _CMP_GT_OQ),
+                                      _mm256_cmp_pd(up_viol, zero, _CMP_GT_OQ));
+      res.num += highsPopcount32(_mm256_movemask_pd(violated));
     }
-    for (HighsInt var = 0; var < num_var; var++) {
-      if (x.value[var] < var_lo[var]) {
-        res.sum += (var_lo[var] - x.value[var]);
+    __m128d lo128 = _mm_add_pd(_mm256_castpd256_pd128(sum_acc),
+                               _mm256_extractf128_pd(sum_acc, 1));
+    res.sum += _mm_cvtsd_f64(_mm_hadd_pd(lo128, lo128));
+#endif
+    for (; i < count; i++) {
+      if (values[i] < lo[i]) {
+        res.sum += (lo[i] - values[i]);
         res.num++;
-      } else if (x.value[var] > var_up[var]) {
-        res.sum += (x.value[var] - var_up[var]);
+      } else if (values[i] > up[i]) {
+        res.sum += (values[i] - up[i]);
         res.num++;
       }
     }
-    return res;
   }
+
+ public:
 };
 
+using Instance = InstanceT<Matrix>;
+
 #endif
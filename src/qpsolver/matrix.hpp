@@ -2,6 +2,7 @@
 #define __SRC_LIB_MATRIX_HPP__
 
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 #include "vector.hpp"
@@ -72,6 +73,7 @@ struct MatrixBase {
       if (dot != 0.0) {
         result.value[i] = dot;
         result.index[result.num_nz] = i;
+        result.in_pattern[i] = 1;
         result.num_nz++;
       }
     }
@@ -132,11 +134,13 @@ struct MatrixBase {
     if (col >= num_col) {
       target.index[0] = col - num_col;
       target.value[col - num_col] = 1.0;
+      target.in_pattern[col - num_col] = 1;
       target.num_nz = 1;
     } else {
       for (HighsInt i = 0; i < start[col + 1] - start[col]; i++) {
         target.index[i] = index[start[col] + i];
         target.value[target.index[i]] = value[start[col] + i];
+        target.in_pattern[target.index[i]] = 1;
       }
       target.num_nz = start[col + 1] - start[col];
     }
@@ -151,10 +155,100 @@ struct MatrixBase {
   }
 };
 
+
+// 8x8-tiled sparse storage built once from a CSC MatrixBase. Each tile
+// packs up to eight entries as local offsets plus values, so applying
+// the matrix runs a fixed-trip inner loop per tile (branch per tile
+// instead of branch per element) over cache-resident slices of the
+// operand. Intended for matrices that are reapplied many times, like
+// the Hessian during a QP solve.
+struct BlockedCSRMatrix {
+  static const HighsInt kBlockSize = 8;
+
+  struct Tile {
+    HighsInt row_base;
+    HighsInt col_base;
+    uint8_t count;
+    uint8_t row_off[8];
+    uint8_t col_off[8];
+    double vals[8];
+  };
+
+  HighsInt num_row = 0;
+  HighsInt num_col = 0;
+  std::vector<Tile> tiles;
+
+  void build(const MatrixBase& mat) {
+    num_row = mat.num_row;
+    num_col = mat.num_col;
+    tiles.clear();
+    // CSC order visits tiles column-block by column-block; remember the
+    // last tile per (row block, col block) to fill tiles up to eight
+    // entries before opening a new one
+    std::vector<HighsInt> open_tile;
+    HighsInt num_row_blocks = (num_row + kBlockSize - 1) / kBlockSize;
+    for (HighsInt col = 0; col < num_col; col++) {
+      HighsInt col_block = col / kBlockSize;
+      for (HighsInt idx = mat.start[col]; idx < mat.start[col + 1]; idx++) {
+        HighsInt row = mat.index[idx];
+        HighsInt row_block = row / kBlockSize;
+        HighsInt key = col_block * num_row_blocks + row_block;
+        if ((HighsInt)open_tile.size() <= key) open_tile.resize(key + 1, -1);
+        HighsInt t = open_tile[key];
+        if (t < 0 || tiles[t].count == kBlockSize) {
+          Tile tile;
+          tile.row_base = row_block * kBlockSize;
+          tile.col_base = col_block * kBlockSize;
+          tile.count = 0;
+          tiles.push_back(tile);
+          t = tiles.size() - 1;
+          open_tile[key] = t;
+        }
+        Tile& tile = tiles[t];
+        tile.row_off[tile.count] = (uint8_t)(row - tile.row_base);
+        tile.col_off[tile.count] = (uint8_t)(col - tile.col_base);
+        tile.vals[tile.count] = mat.value[idx];
+        tile.count++;
+      }
+    }
+  }
+
+  // target = this^T * other, dense accumulation plus resparsify like
+  // MatrixBase::vec_mat_1
+  Vector& vec_mat(const Vector& other, Vector& target) const {
+    target.reset();
+    for (const Tile& tile : tiles) {
+      const double* x = &other.value[tile.row_base];
+      double* out = &target.value[tile.col_base];
+      for (HighsInt k = 0; k < tile.count; k++) {
+        out[tile.col_off[k]] += tile.vals[k] * x[tile.row_off[k]];
+      }
+    }
+    target.resparsify();
+    return target;
+  }
+
+  // target = this * other
+  Vector& mat_vec(const Vector& other, Vector& target) const {
+    target.reset();
+    for (const Tile& tile : tiles) {
+      const double* x = &other.value[tile.col_base];
+      double* out = &target.value[tile.row_base];
+      for (HighsInt k = 0; k < tile.count; k++) {
+        out[tile.row_off[k]] += tile.vals[k] * x[tile.col_off[k]];
+      }
+    }
+    target.resparsify();
+    return target;
+  }
+};
+
 struct Matrix {
  private:
   MatrixBase tran;
   bool has_transpose = false;
+  BlockedCSRMatrix blocked_;
+  bool has_blocked = false;
 
   void transpose() {
     if (!has_transpose) {
@@ -218,6 +312,7 @@ struct Matrix {
     mat.start.push_back(mat.start[mat.num_col] + vec.num_nz);
     mat.num_col++;
     has_transpose = false;
+    has_blocked = false;
   }
 
   void append(HighsInt* idx, double* val, HighsInt nnz) {
@@ -231,6 +326,7 @@ struct Matrix {
     mat.start.push_back(mat.start[mat.num_col] + nnz);
     mat.num_col++;
     has_transpose = false;
+    has_blocked = false;
   }
 
   void append(HighsInt num_nz, HighsInt* index, double* value) {
@@ -244,11 +340,13 @@ struct Matrix {
     mat.start.push_back(mat.start[mat.num_col] + num_nz);
     mat.num_col++;
     has_transpose = false;
+    has_blocked = false;
   }
 
   void dropcol(HighsInt col) {
     assert(col < mat.num_col);
     has_transpose = false;
+    has_blocked = false;
 
     mat.index.erase(mat.index.begin() + mat.start[col],
                     mat.index.begin() + mat.start[col + 1]);
@@ -271,6 +369,16 @@ struct Matrix {
     return tran;
   }
 
+  // lazily built tiled view, invalidated like the transpose whenever the
+  // matrix changes
+  const BlockedCSRMatrix& blocked() {
+    if (!has_blocked) {
+      blocked_.build(mat);
+      has_blocked = true;
+    }
+    return blocked_;
+  }
+
   Matrix mat_mat(Matrix& other) {
     Matrix res(mat.num_row, 0);
 
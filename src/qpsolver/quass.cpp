@@ -40,10 +40,12 @@ Quass::Quass(Runtime& rt) : runtime(rt) {}
 
 void Quass::loginformation(Runtime& rt, Basis& basis, CholeskyFactor& factor) {
   rt.statistics.iteration.push_back(rt.statistics.num_iterations);
-  rt.statistics.nullspacedimension.push_back(rt.instance.num_var -
-                                             basis.getnumactive());
   rt.statistics.objval.push_back(rt.instance.objval(rt.primal));
+  rt.statistics.tsc.push_back(Statistics::readCycleCounter());
+  if (!rt.statistics.detailed) return;
   rt.statistics.time.push_back(runtime.timer.readRunHighsClock());
+  rt.statistics.nullspacedimension.push_back(rt.instance.num_var -
+                                             basis.getnumactive());
   SumNum sm =
       rt.instance.sumnumprimalinfeasibilities(rt.primal, rt.rowactivity);
   rt.statistics.sum_primal_infeasibilities.push_back(sm.sum);
@@ -210,6 +212,9 @@ static void regularize(Runtime& rt) {
 
 void Quass::solve(const Vector& x0, const Vector& ra, Basis& b0) {
   runtime.statistics.time_start = std::chrono::high_resolution_clock::now();
+  runtime.statistics.time_start_tsc = Statistics::readCycleCounter();
+  runtime.statistics.run_clock_at_start = runtime.timer.readRunHighsClock();
+  runtime.statistics.reserve(10 * runtime.instance.num_var + 100);
   Basis& basis = b0;
   runtime.primal = x0;
 
@@ -379,4 +384,6 @@ void Quass::solve(const Vector& x0, const Vector& ra, Basis& b0) {
   }
   // x.report("x");
   runtime.statistics.time_end = std::chrono::high_resolution_clock::now();
+  runtime.statistics.time_end_tsc = Statistics::readCycleCounter();
+  runtime.statistics.finalizeIterationTimes();
 }
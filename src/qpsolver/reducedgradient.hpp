@@ -66,6 +66,8 @@ class ReducedGradient {
     rg.value.push_back(newval);
     rg.index.push_back(0);
     rg.index[rg.num_nz++] = rg.dim++;
+    rg.ensure_pattern_capacity();
+    rg.in_pattern[rg.dim - 1] = 1;
 
     uptodate = true;
   }
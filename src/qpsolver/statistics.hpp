@@ -2,22 +2,86 @@
 #define __SRC_LIB_STATISTICS_HPP__
 
 #include <chrono>
+#include <cstdint>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 struct Statistics {
   HighsInt phase1_iterations = 0;
   HighsInt num_iterations = 0;
   std::chrono::high_resolution_clock::time_point time_start;
   std::chrono::high_resolution_clock::time_point time_end;
+  uint64_t time_start_tsc = 0;
+  uint64_t time_end_tsc = 0;
+  double run_clock_at_start = 0.0;
+
+  // cycle counter for per-iteration timestamps: one register read on the
+  // hot path instead of a clock call; converted to seconds once at the
+  // end of the solve
+  static uint64_t readCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t val;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(val));
+    return val;
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::high_resolution_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  // diagnostic logs below are only recorded (and allocated) when a
+  // consumer opts in, keeping production logging to the core columns
+  bool detailed = false;
 
+  // core per-iteration logs
   std::vector<HighsInt> iteration;
-  std::vector<HighsInt> nullspacedimension;
   std::vector<double> objval;
   std::vector<double> time;
+  std::vector<uint64_t> tsc;
+
+  // diagnostic per-iteration logs, recorded only when detailed is set
+  std::vector<HighsInt> nullspacedimension;
   std::vector<double> sum_primal_infeasibilities;
   std::vector<HighsInt> num_primal_infeasibilities;
   std::vector<double> density_nullspace;
   std::vector<double> density_factor;
+
+  // size-hint all per-iteration logs up front so logging never triggers
+  // a geometric reallocation mid-solve
+  void reserve(size_t n) {
+    iteration.reserve(n);
+    objval.reserve(n);
+    time.reserve(n);
+    tsc.reserve(n);
+    if (!detailed) return;
+    nullspacedimension.reserve(n);
+    sum_primal_infeasibilities.reserve(n);
+    num_primal_infeasibilities.reserve(n);
+    density_nullspace.reserve(n);
+    density_factor.reserve(n);
+  }
+
+  // converts the recorded cycle stamps into run-clock seconds using the
+  // tick rate observed between time_start and time_end. No-op for logs
+  // that already carry wall-clock times (the detailed path records them
+  // live for its end-of-iteration subscriber).
+  void finalizeIterationTimes() {
+    if (time.size() >= tsc.size()) return;
+    double elapsed = std::chrono::duration<double>(time_end - time_start).count();
+    if (elapsed <= 0.0 || time_end_tsc <= time_start_tsc) return;
+    const double seconds_per_tick =
+        elapsed / (double)(time_end_tsc - time_start_tsc);
+    time.resize(tsc.size());
+    for (size_t i = 0; i < tsc.size(); i++)
+      time[i] = run_clock_at_start +
+                (double)(tsc[i] - time_start_tsc) * seconds_per_tick;
+  }
 };
 
 #endif
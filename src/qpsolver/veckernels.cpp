@@ -0,0 +1,110 @@
+#include "qpsolver/veckernels.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VECKERNELS_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace vec_kernels {
+
+// four independent accumulators in every variant to hide the FMA/add
+// latency chain; tails are handled scalarly
+
+static double dot_scalar(const double* a, const double* b, size_t n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += a[i] * b[i];
+    s1 += a[i + 1] * b[i + 1];
+    s2 += a[i + 2] * b[i + 2];
+    s3 += a[i + 3] * b[i + 3];
+  }
+  double dot = (s0 + s1) + (s2 + s3);
+  for (; i < n; i++) dot += a[i] * b[i];
+  return dot;
+}
+
+#ifdef VECKERNELS_X86_DISPATCH
+
+__attribute__((target("avx2,fma"))) static double dot_avx2(const double* a,
+                                                           const double* b,
+                                                           size_t n) {
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  __m256d acc2 = _mm256_setzero_pd();
+  __m256d acc3 = _mm256_setzero_pd();
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(&a[i]), _mm256_loadu_pd(&b[i]),
+                           acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(&a[i + 4]),
+                           _mm256_loadu_pd(&b[i + 4]), acc1);
+    acc2 = _mm256_fmadd_pd(_mm256_loadu_pd(&a[i + 8]),
+                           _mm256_loadu_pd(&b[i + 8]), acc2);
+    acc3 = _mm256_fmadd_pd(_mm256_loadu_pd(&a[i + 12]),
+                           _mm256_loadu_pd(&b[i + 12]), acc3);
+  }
+  acc0 = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+  __m128d lo = _mm_add_pd(_mm256_castpd256_pd128(acc0),
+                          _mm256_extractf128_pd(acc0, 1));
+  double dot = _mm_cvtsd_f64(_mm_hadd_pd(lo, lo));
+  for (; i < n; i++) dot += a[i] * b[i];
+  return dot;
+}
+
+__attribute__((target("avx512f"))) static double dot_avx512(const double* a,
+                                                            const double* b,
+                                                            size_t n) {
+  __m512d acc0 = _mm512_setzero_pd();
+  __m512d acc1 = _mm512_setzero_pd();
+  __m512d acc2 = _mm512_setzero_pd();
+  __m512d acc3 = _mm512_setzero_pd();
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(&a[i]), _mm512_loadu_pd(&b[i]),
+                           acc0);
+    acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(&a[i + 8]),
+                           _mm512_loadu_pd(&b[i + 8]), acc1);
+    acc2 = _mm512_fmadd_pd(_mm512_loadu_pd(&a[i + 16]),
+                           _mm512_loadu_pd(&b[i + 16]), acc2);
+    acc3 = _mm512_fmadd_pd(_mm512_loadu_pd(&a[i + 24]),
+                           _mm512_loadu_pd(&b[i + 24]), acc3);
+  }
+  acc0 = _mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3));
+  // the masked extract with a zeroed source instead of
+  // _mm512_reduce_add_pd: the reduce expands through an undefined
+  // upper-half operand in GCC's headers, and this assembles to the
+  // same vextractf64x4
+  // both halves: the plain cast also routes through the same expansion
+  __m256d half = _mm256_add_pd(
+      _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), (__mmask8)-1, acc0, 0),
+      _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), (__mmask8)-1, acc0, 1));
+  __m128d lo = _mm_add_pd(_mm256_castpd256_pd128(half),
+                          _mm256_extractf128_pd(half, 1));
+  double dot = _mm_cvtsd_f64(_mm_hadd_pd(lo, lo));
+  for (; i < n; i++) dot += a[i] * b[i];
+  return dot;
+}
+
+// trampoline: the first call probes the CPU, rebinds the pointer and
+// tail-calls the selected kernel; later calls go straight through
+static double dot_resolve(const double* a, const double* b, size_t n) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    dot_dense = dot_avx512;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    dot_dense = dot_avx2;
+  else
+    dot_dense = dot_scalar;
+  return dot_dense(a, b, n);
+}
+
+dot_fn dot_dense = dot_resolve;
+
+#else
+
+dot_fn dot_dense = dot_scalar;
+
+#endif
+
+}  // namespace vec_kernels
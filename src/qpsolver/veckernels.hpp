@@ -0,0 +1,18 @@
+#ifndef __SRC_LIB_VECKERNELS_HPP__
+#define __SRC_LIB_VECKERNELS_HPP__
+
+#include <cstddef>
+
+// runtime-dispatched dense vector kernels: one binary carries scalar,
+// AVX2+FMA and AVX-512 variants and the widest one supported by the
+// executing CPU is picked on first call
+namespace vec_kernels {
+
+typedef double (*dot_fn)(const double* a, const double* b, size_t n);
+
+// contiguous dot product over n doubles; call through this pointer
+extern dot_fn dot_dense;
+
+}  // namespace vec_kernels
+
+#endif
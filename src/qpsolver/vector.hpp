@@ -3,30 +3,80 @@
 
 #include <util/HighsInt.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "qpsolver/alignedallocator.hpp"
+#include "qpsolver/veckernels.hpp"
+
 struct Vector {
   HighsInt num_nz;
   HighsInt dim;
-  std::vector<HighsInt> index;
-  std::vector<double> value;
+  std::vector<HighsInt, UninitAlignedAllocator<HighsInt>> index;
+  DVec value;
+  // membership bitmap: in_pattern[j] != 0 iff j occurs in index[0..num_nz).
+  // Lets insertion test "is this slot already in the pattern?" in O(1)
+  // instead of relying on value[j] == 0.0.
+  std::vector<uint8_t> in_pattern;
 
   Vector(HighsInt d) : dim(d) {
     index.resize(dim);
     value.resize(dim, 0.0);
+    in_pattern.resize(dim, 0);
     num_nz = 0;
   }
 
   Vector(const Vector& vec)
-      : num_nz(vec.num_nz), dim(vec.dim), index(vec.index), value(vec.value) {}
+      : num_nz(vec.num_nz),
+        dim(vec.dim),
+        index(vec.index),
+        value(vec.value),
+        in_pattern(vec.in_pattern) {}
+
+  // moves steal the buffers so chained operator expressions and
+  // return-by-value never deep-copy dim-sized arrays
+  Vector(Vector&& vec) noexcept
+      : num_nz(vec.num_nz),
+        dim(vec.dim),
+        index(std::move(vec.index)),
+        value(std::move(vec.value)),
+        in_pattern(std::move(vec.in_pattern)) {
+    vec.num_nz = 0;
+  }
+
+  Vector& operator=(Vector&& other) noexcept {
+    num_nz = other.num_nz;
+    dim = other.dim;
+    index = std::move(other.index);
+    value = std::move(other.value);
+    in_pattern = std::move(other.in_pattern);
+    other.num_nz = 0;
+    return *this;
+  }
+
+  // callers may grow dim by pushing onto index/value directly; keep the
+  // bitmap sized accordingly before the class touches it
+  void ensure_pattern_capacity() {
+    if ((HighsInt)in_pattern.size() < dim) in_pattern.resize(dim, 0);
+  }
 
   void reset() {
-    for (HighsInt i = 0; i < num_nz; i++) {
-      value[index[i]] = 0;
-      index[i] = 0;
+    ensure_pattern_capacity();
+    if (num_nz > dim / 4) {
+      // dense patterns clear faster with two sequential fills than with
+      // a gathered store per entry
+      std::fill(value.begin(), value.begin() + dim, 0.0);
+      std::fill(in_pattern.begin(), in_pattern.begin() + dim, 0);
+    } else {
+      for (HighsInt i = 0; i < num_nz; i++) {
+        value[index[i]] = 0;
+        in_pattern[index[i]] = 0;
+      }
     }
     num_nz = 0;
   }
@@ -36,6 +86,7 @@ struct Vector {
     for (HighsInt i = 0; i < other.num_nz; i++) {
       index[i] = other.index[i];
       value[index[i]] = other.value[index[i]];
+      in_pattern[index[i]] = 1;
     }
     num_nz = other.num_nz;
     return *this;
@@ -44,15 +95,30 @@ struct Vector {
   Vector& operator=(const Vector& other) {
     num_nz = other.num_nz;
     dim = other.dim;
-    index = other.index;
+    // index[] is only meaningful below num_nz, so copying its tail is
+    // wasted bandwidth. value[] and the bitmap keep full copies:
+    // assignment targets can carry nonzeros written outside their
+    // pattern (e.g. after a dense triangular solve) which a
+    // pattern-only copy would leave behind.
+    if (index.size() < other.index.size()) index.resize(other.index.size());
+    std::copy(other.index.begin(), other.index.begin() + num_nz,
+              index.begin());
     value = other.value;
+    in_pattern = other.in_pattern;
     return *this;
   }
 
   static Vector& unit(HighsInt dim, HighsInt u, Vector& target) {
+    if (target.num_nz == 1 && target.index[0] == u) {
+      // already a singleton on u: overwrite in place, no clearing needed
+      target.value[u] = 1.0;
+      target.in_pattern[u] = 1;
+      return target;
+    }
     target.reset();
     target.index[0] = u;
     target.value[u] = 1.0;
+    target.in_pattern[u] = 1;
     target.num_nz = 1;
     return target;
   }
@@ -61,49 +127,94 @@ struct Vector {
     Vector vec(dim);
     vec.index[0] = u;
     vec.value[u] = 1.0;
+    vec.in_pattern[u] = 1;
     vec.num_nz = 1;
     return vec;
   }
 
-  void report(std::string name = "") {
+  // debug aid only: formats the pattern into one buffer and emits it
+  // with a single fwrite instead of a printf per nonzero. Compiled out
+  // of release builds.
+  void report(std::string name = "", FILE* stream = stdout) const {
+#ifndef NDEBUG
+    std::string line;
+    line.reserve(32 * (size_t)num_nz + name.size() + 4);
+    char entry[64];
     if (name != "") {
-      printf("%s: ", name.c_str());
+      line += name;
+      line += ": ";
     }
     for (HighsInt i = 0; i < num_nz; i++) {
-      printf("[%" HIGHSINT_FORMAT "] %lf ", index[i], value[index[i]]);
+      snprintf(entry, sizeof entry, "[%" HIGHSINT_FORMAT "] %lf ", index[i],
+               value[index[i]]);
+      line += entry;
     }
-    printf("\n");
+    line += "\n";
+    fwrite(line.data(), 1, line.size(), stream);
+#else
+    (void)name;
+    (void)stream;
+#endif
   }
 
-  double norm2() {
-    double val = 0.0;
-
-    for (HighsInt i = 0; i < num_nz; i++) {
+  double norm2() const {
+    // dense vectors go through the dispatched contiguous SIMD kernel;
+    // the gathered loop keeps four accumulators so the squares do not
+    // serialize on one floating point add chain.
+    if (is_dense()) return vec_kernels::dot_dense(value.data(), value.data(), dim);
+
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    HighsInt i = 0;
+    for (; i + 4 <= num_nz; i += 4) {
+      const double v0 = value[index[i]];
+      const double v1 = value[index[i + 1]];
+      const double v2 = value[index[i + 2]];
+      const double v3 = value[index[i + 3]];
+      s0 += v0 * v0;
+      s1 += v1 * v1;
+      s2 += v2 * v2;
+      s3 += v3 * v3;
+    }
+    double val = (s0 + s1) + (s2 + s3);
+    for (; i < num_nz; i++) {
       val += value[index[i]] * value[index[i]];
     }
 
     return val;
   }
 
+  void sort_indices() { std::sort(index.begin(), index.begin() + num_nz); }
+
   void sanitize(double threshold = 10E-15) {
+    ensure_pattern_capacity();
     HighsInt new_idx = 0;
 
     for (HighsInt i = 0; i < num_nz; i++) {
       if (fabs(value[index[i]]) > threshold) {
+        in_pattern[index[i]] = 1;
         index[new_idx++] = index[i];
       } else {
         value[index[i]] = 0.0;
-        index[i] = 0;
+        in_pattern[index[i]] = 0;
       }
     }
     num_nz = new_idx;
+    sort_indices();
   }
 
+  // rebuilds the pattern from the dense array. Only needed by callers
+  // that wrote to value[] directly; the class mutators maintain the
+  // pattern incrementally.
   void resparsify() {
+    ensure_pattern_capacity();
     num_nz = 0;
     for (HighsInt i = 0; i < dim; i++) {
       if (value[i] != 0.0) {
-        index[num_nz++] = i;
+        index[num_nz] = i;
+        in_pattern[i] = 1;
+        num_nz++;
+      } else {
+        in_pattern[i] = 0;
       }
     }
   }
@@ -122,15 +233,14 @@ struct Vector {
   }
 
   Vector& saxpy(double a, const Vector& x) {
-    sanitize(0.0);
+    ensure_pattern_capacity();
     for (HighsInt i = 0; i < x.num_nz; i++) {
-      if (value[x.index[i]] == 0.0) {
+      if (!in_pattern[x.index[i]]) {
+        in_pattern[x.index[i]] = 1;
         index[num_nz++] = x.index[i];
       }
       value[x.index[i]] += a * x.value[x.index[i]];
     }
-    resparsify();
-    // sanitize(0.0);
     return *this;
   }
 
@@ -141,13 +251,55 @@ struct Vector {
   //    resparsify();
   // }
 
+  // sorted-merge construction of this +/- other: touches only the two
+  // patterns instead of all dim slots. Requires both patterns sorted.
+  template <int sign>
+  Vector add_merge(const Vector& other) const {
+    Vector result(dim);
+
+    HighsInt i = 0, j = 0;
+    while (i < num_nz || j < other.num_nz) {
+      HighsInt idx;
+      double val;
+      if (j >= other.num_nz || (i < num_nz && index[i] < other.index[j])) {
+        idx = index[i];
+        val = value[idx];
+        i++;
+      } else if (i >= num_nz || other.index[j] < index[i]) {
+        idx = other.index[j];
+        val = sign * other.value[idx];
+        j++;
+      } else {
+        idx = index[i];
+        val = value[idx] + sign * other.value[idx];
+        i++;
+        j++;
+      }
+      if (val != 0.0) {
+        result.value[idx] = val;
+        result.index[result.num_nz] = idx;
+        result.in_pattern[idx] = 1;
+        result.num_nz++;
+      }
+    }
+
+    return result;
+  }
+
   Vector operator+(const Vector& other) const {
+    if (std::is_sorted(index.begin(), index.begin() + num_nz) &&
+        std::is_sorted(other.index.begin(),
+                       other.index.begin() + other.num_nz))
+      return add_merge<1>(other);
+
     Vector result(dim);
 
     for (HighsInt i = 0; i < dim; i++) {
       result.value[i] = value[i] + other.value[i];
       if (result.value[i] != 0.0) {
-        result.index[result.num_nz++] = i;
+        result.index[result.num_nz] = i;
+        result.in_pattern[i] = 1;
+        result.num_nz++;
       }
     }
 
@@ -155,12 +307,19 @@ struct Vector {
   }
 
   Vector operator-(const Vector& other) const {
+    if (std::is_sorted(index.begin(), index.begin() + num_nz) &&
+        std::is_sorted(other.index.begin(),
+                       other.index.begin() + other.num_nz))
+      return add_merge<-1>(other);
+
     Vector result(dim);
 
     for (HighsInt i = 0; i < dim; i++) {
       result.value[i] = value[i] - other.value[i];
       if (result.value[i] != 0.0) {
-        result.index[result.num_nz++] = i;
+        result.index[result.num_nz] = i;
+        result.in_pattern[i] = 1;
+        result.num_nz++;
       }
     }
 
@@ -173,6 +332,7 @@ struct Vector {
     for (HighsInt i = 0; i < num_nz; i++) {
       result.index[i] = index[i];
       result.value[index[i]] = -value[index[i]];
+      result.in_pattern[index[i]] = 1;
     }
     result.num_nz = num_nz;
 
@@ -185,13 +345,57 @@ struct Vector {
     for (HighsInt i = 0; i < num_nz; i++) {
       result.index[i] = index[i];
       result.value[index[i]] = d * value[index[i]];
+      result.in_pattern[index[i]] = 1;
     }
     result.num_nz = num_nz;
 
     return result;
   }
 
+  // a vector counts as dense when most of its entries are nonzero, so that
+  // walking value[] contiguously beats gathering through index[]
+  bool is_dense() const { return num_nz > dim * 3 / 4; }
+
+  // merge-join over two sorted sparse patterns: advances the smaller
+  // cursor so other.value[] is never gathered at random. Four round-robin
+  // accumulators break the floating point add latency chain.
+  double dot_sparse(const Vector& other) const {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    HighsInt i = 0, j = 0, hits = 0;
+    while (i < num_nz && j < other.num_nz) {
+      if (index[i] == other.index[j]) {
+        double prod = value[index[i]] * other.value[other.index[j]];
+        switch (hits++ & 3) {
+          case 0:
+            s0 += prod;
+            break;
+          case 1:
+            s1 += prod;
+            break;
+          case 2:
+            s2 += prod;
+            break;
+          default:
+            s3 += prod;
+        }
+        i++;
+        j++;
+      } else if (index[i] < other.index[j]) {
+        i++;
+      } else {
+        j++;
+      }
+    }
+    return (s0 + s1) + (s2 + s3);
+  }
+
   double dot(const Vector& other) const {
+    if (is_dense() && other.is_dense())
+      return vec_kernels::dot_dense(value.data(), other.value.data(), dim);
+    if (num_nz + other.num_nz < dim / 4 &&
+        std::is_sorted(index.begin(), index.begin() + num_nz) &&
+        std::is_sorted(other.index.begin(), other.index.begin() + other.num_nz))
+      return dot_sparse(other);
     double dot = 0.0;
     for (HighsInt i = 0; i < num_nz; i++) {
       dot += value[index[i]] * other.value[index[i]];
@@ -200,6 +404,7 @@ struct Vector {
     return dot;
   }
 
+
   double operator*(const Vector& other) const { return dot(other); }
 
   double dot(const HighsInt* idx, const double* val, HighsInt nnz) const {
@@ -212,14 +417,14 @@ struct Vector {
   }
 
   Vector& operator+=(const Vector& other) {
-    // sanitize();
+    ensure_pattern_capacity();
     for (HighsInt i = 0; i < other.num_nz; i++) {
-      // if (value[other.index[i]] == 0.0) {
-      //    index[num_nz++] = other.index[i];
-      // }
+      if (!in_pattern[other.index[i]]) {
+        in_pattern[other.index[i]] = 1;
+        index[num_nz++] = other.index[i];
+      }
       value[other.index[i]] += other.value[other.index[i]];
     }
-    resparsify();
     return *this;
   }
 
@@ -15,6 +15,10 @@
  */
 #include "simplex/HEkkDualRow.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include <cassert>
 #include <iostream>
 
@@ -22,12 +26,20 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsCDouble.h"
-#include "util/HighsSort.h"
 
 using std::make_pair;
 using std::min;
 using std::pair;
-using std::set;
+using std::swap;
+
+// Tolerance below which a pivotal row entry cannot be a CHUZC
+// candidate, relaxed as the basis inverse representation ages with
+// the update count. Shared by choosePossible and createFreemove so
+// the ladder lives in one place and its value hoists out of their
+// loops
+static inline double chuzcSmallEntryTolerance(const HighsInt update_count) {
+  return update_count < 10 ? 1e-9 : update_count < 20 ? 3e-8 : 1e-6;
+}
 
 void HEkkDualRow::setupSlice(HighsInt size) {
   workSize = size;
@@ -43,6 +55,10 @@ void HEkkDualRow::setupSlice(HighsInt size) {
 
   workCount = 0;
   workData.resize(workSize);
+  workTight.resize(workSize);
+  workRangeCand.resize(workSize);
+  sorted_workData.resize(workSize);
+  heap_ratio.resize(workSize);
   analysis = &ekk_instance_.analysis_;
 }
 
@@ -74,7 +90,24 @@ void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset) {
   const HighsInt rowCount = row->count;
   const HighsInt* rowIndex = &row->index[0];
   const double* rowArray = &row->array[0];
-  for (HighsInt i = 0; i < rowCount; i++) {
+  HighsInt i = 0;
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+  // Gather four row values per step through the index list, and store
+  // the offset indices and values contiguously into the pack arrays
+  const __m128i offset_v = _mm_set1_epi32(offset);
+  const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+  for (; i + 4 <= rowCount; i += 4) {
+    const __m128i idx =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rowIndex[i]));
+    const __m256d value_v = _mm256_mask_i32gather_pd(
+        _mm256_setzero_pd(), rowArray, idx, all_lanes, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&packIndex[packCount]),
+                     _mm_add_epi32(idx, offset_v));
+    _mm256_storeu_pd(&packValue[packCount], value_v);
+    packCount += 4;
+  }
+#endif
+  for (; i < rowCount; i++) {
     const HighsInt index = rowIndex[i];
     const double value = rowArray[index];
     packIndex[packCount] = index + offset;
@@ -87,9 +120,8 @@ void HEkkDualRow::choosePossible() {
    * Determine the possible variables - candidates for CHUZC
    * TODO: Check with Qi what this is doing
    */
-  const double Ta = ekk_instance_.info_.update_count < 10   ? 1e-9
-                    : ekk_instance_.info_.update_count < 20 ? 3e-8
-                                                            : 1e-6;
+  const double Ta =
+      chuzcSmallEntryTolerance(ekk_instance_.info_.update_count);
   const double Td = ekk_instance_.options_->dual_feasibility_tolerance;
   const HighsInt move_out = workDelta < 0 ? -1 : 1;
   workTheta = kHighsInf;
@@ -145,14 +177,24 @@ HighsInt HEkkDualRow::chooseFinal() {
   double totalChange = 0;
   const double totalDelta = fabs(workDelta);
   double selectTheta = 10 * workTheta + 1e-7;
+  // Cache workMove[iCol]*workDual[iCol] and workRange[iCol] alongside
+  // workData: the BFRT passes here and in chooseFinalWorkGroupQuad
+  // re-read each candidate every pass, so gather the scattered arrays
+  // only once
+  for (HighsInt i = 0; i < fullCount; i++) {
+    const HighsInt iCol = workData[i].first;
+    workTight[i] = workMove[iCol] * workDual[iCol];
+    workRangeCand[i] = workRange[iCol];
+  }
   for (;;) {
     for (HighsInt i = workCount; i < fullCount; i++) {
-      HighsInt iCol = workData[i].first;
       double alpha = workData[i].second;
-      double tight = workMove[iCol] * workDual[iCol];
+      double tight = workTight[i];
       if (alpha * selectTheta >= tight) {
+        totalChange += workRangeCand[i] * alpha;
+        swap(workTight[workCount], workTight[i]);
+        swap(workRangeCand[workCount], workRangeCand[i]);
         swap(workData[workCount++], workData[i]);
-        totalChange += workRange[iCol] * alpha;
       }
     }
     selectTheta *= 10;
@@ -181,10 +223,10 @@ HighsInt HEkkDualRow::chooseFinal() {
   }
 
   if (use_heap_sort) {
-    printf("CHUZC: Using heap sort\n");
-    // Take a copy of workData and workCount for the independent
-    // heap-based code
-    original_workData = workData;
+    if (report_bfrt) printf("CHUZC: Using heap sort\n");
+    // Record the candidate count for the independent heap-based code,
+    // which reads workData in place and writes its selection to
+    // sorted_workData
     alt_workCount = workCount;
   }
   analysis->simplexTimerStart(Chuzc4Clock);
@@ -270,18 +312,21 @@ HighsInt HEkkDualRow::chooseFinal() {
       if (report_bfrt) debugReportBfrtVar(i, workData);
       const HighsInt iCol = workData[i].first;
       const HighsInt move = workMove[iCol];
-      workData[workCount++] = make_pair(iCol, move * workRange[iCol]);
+      workData[workCount++] = make_pair(iCol, move * workRangeCand[i]);
     }
     for (HighsInt i = workGroup[breakGroup]; i < workGroup[breakGroup + 1]; i++)
       if (report_bfrt) debugReportBfrtVar(i, workData);
   } else {
-    printf("DebugHeapSortCHUZC: Pivot = %4d; alpha = %11.4g; theta = %11.4g\n",
-           (int)workPivot, workAlpha, workTheta);
-    debugReportBfrtVar(-1, sorted_workData);
+    if (report_bfrt) {
+      printf(
+          "DebugHeapSortCHUZC: Pivot = %4d; alpha = %11.4g; theta = %11.4g\n",
+          (int)workPivot, workAlpha, workTheta);
+      debugReportBfrtVar(-1, sorted_workData);
+    }
     for (HighsInt i = 0; i < alt_workGroup[breakGroup]; i++) {
       const HighsInt iCol = sorted_workData[i].first;
       const HighsInt move = workMove[iCol];
-      debugReportBfrtVar(i, sorted_workData);
+      if (report_bfrt) debugReportBfrtVar(i, sorted_workData);
       workData[workCount++] = make_pair(iCol, move * workRange[iCol]);
     }
     // Look at all entries of final group to see what dual
@@ -292,7 +337,7 @@ HighsInt HEkkDualRow::chooseFinal() {
     //    HighsInt num_infeasibility = 0;
     const double Td = ekk_instance_.options_->dual_feasibility_tolerance;
     for (HighsInt i = alt_workGroup[breakGroup]; i < to_i; i++) {
-      debugReportBfrtVar(i, sorted_workData);
+      if (report_bfrt) debugReportBfrtVar(i, sorted_workData);
       const HighsInt iCol = sorted_workData[i].first;
       const double value = sorted_workData[i].second;
       const HighsInt move = workMove[iCol];
@@ -326,6 +371,12 @@ bool HEkkDualRow::chooseFinalWorkGroupQuad() {
   double totalChange = kInitialTotalChange;
   double selectTheta = workTheta;
   const double totalDelta = fabs(workDelta);
+  // Local restrict-qualified pointers: the candidate arrays are
+  // distinct, but through the member indirection the compiler cannot
+  // prove it and reloads them every pass
+  std::pair<HighsInt, double>* __restrict data = workData.data();
+  double* __restrict tight = workTight.data();
+  double* __restrict range = workRangeCand.data();
   workGroup.clear();
   workGroup.push_back(0);
   HighsInt prev_workCount = workCount;
@@ -338,13 +389,14 @@ bool HEkkDualRow::chooseFinalWorkGroupQuad() {
     debug_num_loop++;
     HighsInt debug_loop_ln = 0;
     for (HighsInt i = workCount; i < fullCount; i++) {
-      HighsInt iCol = workData[i].first;
-      double value = workData[i].second;
-      double dual = workMove[iCol] * workDual[iCol];
+      double value = data[i].second;
+      double dual = tight[i];
       // Tight satisfy
       if (dual <= selectTheta * value) {
-        swap(workData[workCount++], workData[i]);
-        totalChange += value * (workRange[iCol]);
+        totalChange += value * range[i];
+        swap(tight[workCount], tight[i]);
+        swap(range[workCount], range[i]);
+        swap(data[workCount++], data[i]);
       } else if (dual + Td < remainTheta * value) {
         remainTheta = (dual + Td) / value;
       }
@@ -400,13 +452,14 @@ bool HEkkDualRow::quadChooseFinalWorkGroupQuad() {
     debug_num_loop++;
     HighsInt debug_loop_ln = 0;
     for (HighsInt i = workCount; i < fullCount; i++) {
-      HighsInt iCol = workData[i].first;
       HighsCDouble value = workData[i].second;
-      HighsCDouble dual = workMove[iCol] * workDual[iCol];
+      HighsCDouble dual = workTight[i];
       // Tight satisfy
       if (dual <= selectTheta * value) {
+        totalChange += value * workRangeCand[i];
+        swap(workTight[workCount], workTight[i]);
+        swap(workRangeCand[workCount], workRangeCand[i]);
         swap(workData[workCount++], workData[i]);
-        totalChange += value * (workRange[iCol]);
       } else if (dual + Td < remainTheta * value) {
         remainTheta = (dual + Td) / value;
       }
@@ -450,22 +503,16 @@ bool HEkkDualRow::chooseFinalWorkGroupHeap() {
   double selectTheta = workTheta;
   const double totalDelta = fabs(workDelta);
   HighsInt heap_num_en = 0;
-  std::vector<HighsInt> heap_i;
-  std::vector<double> heap_v;
-  heap_i.resize(fullCount + 1);
-  heap_v.resize(fullCount + 1);
   for (HighsInt i = 0; i < fullCount; i++) {
-    HighsInt iCol = original_workData[i].first;
-    double value = original_workData[i].second;
-    double dual = workMove[iCol] * workDual[iCol];
+    double value = workData[i].second;
+    double dual = workTight[i];
     double ratio = dual / value;
-    if (ratio < kMaxSelectTheta) {
-      heap_num_en++;
-      heap_i[heap_num_en] = i;
-      heap_v[heap_num_en] = ratio;
-    }
+    if (ratio < kMaxSelectTheta)
+      heap_ratio[heap_num_en++] = make_pair(ratio, i);
   }
-  maxheapsort(&heap_v[0], &heap_i[0], heap_num_en);
+  // Sort the ratios ascending: pdqsort on the contiguous pair array
+  // rather than heapsort, whose sift-downs jump around the heap
+  pdqsort(heap_ratio.begin(), heap_ratio.begin() + heap_num_en);
 
   alt_workCount = 0;
   alt_workGroup.clear();
@@ -473,18 +520,16 @@ bool HEkkDualRow::chooseFinalWorkGroupHeap() {
   if (heap_num_en <= 0) {
     HighsInt num_var = ekk_instance_.lp_.num_col_ + ekk_instance_.lp_.num_row_;
     // No entries in heap = > failure
-    debugDualChuzcFailHeap(*ekk_instance_.options_, alt_workCount,
-                           original_workData, num_var, workDual, selectTheta,
-                           true);
+    debugDualChuzcFailHeap(*ekk_instance_.options_, alt_workCount, workData,
+                           num_var, workDual, selectTheta, true);
     return false;
   }
   HighsInt this_group_first_entry = alt_workCount;
-  sorted_workData.resize(heap_num_en);
-  for (HighsInt en = 1; en <= heap_num_en; en++) {
-    HighsInt i = heap_i[en];
-    HighsInt iCol = original_workData[i].first;
-    double value = original_workData[i].second;
-    double dual = workMove[iCol] * workDual[iCol];
+  for (HighsInt en = 0; en < heap_num_en; en++) {
+    HighsInt i = heap_ratio[en].second;
+    HighsInt iCol = workData[i].first;
+    double value = workData[i].second;
+    double dual = workTight[i];
     if (dual > selectTheta * value) {
       // Breakpoint is in the next group, so record the pointer to its
       // first entry
@@ -498,7 +543,7 @@ bool HEkkDualRow::chooseFinalWorkGroupHeap() {
     // Store the breakpoint
     sorted_workData[alt_workCount].first = iCol;
     sorted_workData[alt_workCount].second = value;
-    totalChange += value * (workRange[iCol]);
+    totalChange += value * workRangeCand[i];
     alt_workCount++;
   }
   if (alt_workCount > this_group_first_entry)
@@ -510,9 +555,10 @@ void HEkkDualRow::chooseFinalLargeAlpha(
     HighsInt& breakIndex, HighsInt& breakGroup, HighsInt pass_workCount,
     const std::vector<std::pair<HighsInt, double>>& pass_workData,
     const std::vector<HighsInt>& pass_workGroup) {
+  const std::pair<HighsInt, double>* data = pass_workData.data();
   double finalCompare = 0;
   for (HighsInt i = 0; i < pass_workCount; i++)
-    finalCompare = max(finalCompare, pass_workData[i].second);
+    finalCompare = max(finalCompare, data[i].second);
   finalCompare = min(0.1 * finalCompare, 1.0);
   HighsInt countGroup = pass_workGroup.size() - 1;
   breakGroup = -1;
@@ -522,19 +568,20 @@ void HEkkDualRow::chooseFinalLargeAlpha(
     HighsInt iMaxFinal = -1;
     for (HighsInt i = pass_workGroup[iGroup]; i < pass_workGroup[iGroup + 1];
          i++) {
-      if (dMaxFinal < pass_workData[i].second) {
-        dMaxFinal = pass_workData[i].second;
+      const double value = data[i].second;
+      if (dMaxFinal < value) {
+        dMaxFinal = value;
         iMaxFinal = i;
-      } else if (dMaxFinal == pass_workData[i].second) {
-        HighsInt jCol = pass_workData[iMaxFinal].first;
-        HighsInt iCol = pass_workData[i].first;
+      } else if (dMaxFinal == value) {
+        HighsInt jCol = data[iMaxFinal].first;
+        HighsInt iCol = data[i].first;
         if (workNumTotPermutation[iCol] < workNumTotPermutation[jCol]) {
           iMaxFinal = i;
         }
       }
     }
 
-    if (pass_workData[iMaxFinal].second > finalCompare) {
+    if (dMaxFinal > finalCompare) {
       breakIndex = iMaxFinal;
       breakGroup = iGroup;
       break;
@@ -562,15 +609,57 @@ void HEkkDualRow::updateFlip(HVector* bfrtColumn) {
 void HEkkDualRow::updateDual(double theta) {
   analysis->simplexTimerStart(UpdateDualClock);
   double* workDual = &ekk_instance_.info_.workDual_[0];
+  const double* workValue = &ekk_instance_.info_.workValue_[0];
+  const int8_t* nonbasicFlag = &ekk_instance_.basis_.nonbasicFlag_[0];
   double dual_objective_value_change = 0;
-  for (HighsInt i = 0; i < packCount; i++) {
+  HighsInt i = 0;
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+  // Four entries at a time: gather the duals and values at the packed
+  // indices, and accumulate the dual objective change lane-wise,
+  // applying the constant cost scale once to the reduced sum. The
+  // updated duals and the nonbasicFlag factors go through scalar
+  // element accesses, since AVX2 has no scatter and the flags are
+  // 8-bit
+  const __m256d theta_v = _mm256_set1_pd(theta);
+  const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+  __m256d change_v = _mm256_setzero_pd();
+  for (; i + 4 <= packCount; i += 4) {
+    const __m128i idx =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&packIndex[i]));
+    const __m256d delta_dual =
+        _mm256_mul_pd(_mm256_loadu_pd(&packValue[i]), theta_v);
+    const __m256d new_dual =
+        _mm256_sub_pd(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), workDual,
+                                               idx, all_lanes, 8),
+                      delta_dual);
+    alignas(32) double new_dual_s[4];
+    _mm256_store_pd(new_dual_s, new_dual);
+    workDual[packIndex[i]] = new_dual_s[0];
+    workDual[packIndex[i + 1]] = new_dual_s[1];
+    workDual[packIndex[i + 2]] = new_dual_s[2];
+    workDual[packIndex[i + 3]] = new_dual_s[3];
+    const __m256d local_value = _mm256_mask_i32gather_pd(
+        _mm256_setzero_pd(), workValue, idx, all_lanes, 8);
+    const __m256d flag = _mm256_set_pd(
+        nonbasicFlag[packIndex[i + 3]], nonbasicFlag[packIndex[i + 2]],
+        nonbasicFlag[packIndex[i + 1]], nonbasicFlag[packIndex[i]]);
+    change_v = _mm256_sub_pd(
+        change_v, _mm256_mul_pd(_mm256_mul_pd(local_value, delta_dual), flag));
+  }
+  alignas(32) double change_s[4];
+  _mm256_store_pd(change_s, change_v);
+  dual_objective_value_change = ekk_instance_.cost_scale_ *
+                                (change_s[0] + change_s[1] + change_s[2] +
+                                 change_s[3]);
+#endif
+  for (; i < packCount; i++) {
     workDual[packIndex[i]] -= theta * packValue[i];
     // Identify the change to the dual objective
     HighsInt iCol = packIndex[i];
     const double delta_dual = theta * packValue[i];
-    const double local_value = ekk_instance_.info_.workValue_[iCol];
+    const double local_value = workValue[iCol];
     double local_dual_objective_change =
-        ekk_instance_.basis_.nonbasicFlag_[iCol] * (-local_value * delta_dual);
+        nonbasicFlag[iCol] * (-local_value * delta_dual);
     local_dual_objective_change *= ekk_instance_.cost_scale_;
     dual_objective_value_change += local_dual_objective_change;
   }
@@ -580,43 +669,102 @@ void HEkkDualRow::updateDual(double theta) {
 }
 
 void HEkkDualRow::createFreelist() {
+  const HighsInt num_col = ekk_instance_.lp_.num_col_;
+  const HighsInt num_row = ekk_instance_.lp_.num_row_;
+  const HighsInt numTot = num_col + num_row;
   freeList.clear();
-  for (HighsInt i = 0;
-       i < ekk_instance_.lp_.num_col_ + ekk_instance_.lp_.num_row_; i++) {
+  freeListPos.assign(numTot, -1);
+  for (HighsInt i = 0; i < numTot; i++) {
     if (ekk_instance_.basis_.nonbasicFlag_[i] &&
         highs_isInfinity(-ekk_instance_.info_.workLower_[i]) &&
-        highs_isInfinity(ekk_instance_.info_.workUpper_[i]))
-      freeList.insert(i);
+        highs_isInfinity(ekk_instance_.info_.workUpper_[i])) {
+      freeListPos[i] = freeList.size();
+      freeList.push_back(i);
+    }
+  }
+  // Build the row-wise structure of the free columns' nonzeros, with
+  // a free logical appearing as a unit entry in its row
+  const HighsSparseMatrix& a_matrix = ekk_instance_.lp_.a_matrix_;
+  freeRowStart.assign(num_row + 1, 0);
+  for (HighsInt iCol : freeList) {
+    if (iCol < num_col) {
+      for (HighsInt iEl = a_matrix.start_[iCol];
+           iEl < a_matrix.start_[iCol + 1]; iEl++)
+        freeRowStart[a_matrix.index_[iEl] + 1]++;
+    } else {
+      freeRowStart[iCol - num_col + 1]++;
+    }
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    freeRowStart[iRow + 1] += freeRowStart[iRow];
+  freeRowCol.resize(freeRowStart[num_row]);
+  freeRowValue.resize(freeRowStart[num_row]);
+  std::vector<HighsInt> fill(freeRowStart.begin(), freeRowStart.end() - 1);
+  for (HighsInt iCol : freeList) {
+    if (iCol < num_col) {
+      for (HighsInt iEl = a_matrix.start_[iCol];
+           iEl < a_matrix.start_[iCol + 1]; iEl++) {
+        const HighsInt k = fill[a_matrix.index_[iEl]]++;
+        freeRowCol[k] = iCol;
+        freeRowValue[k] = a_matrix.value_[iEl];
+      }
+    } else {
+      const HighsInt k = fill[iCol - num_col]++;
+      freeRowCol[k] = iCol;
+      freeRowValue[k] = 1.0;
+    }
   }
   //  debugFreeListNumEntries(ekk_instance_, freeList);
 }
 
 void HEkkDualRow::createFreemove(HVector* row_ep) {
-  // TODO: Check with Qi what this is doing and why it's expensive
-  if (!freeList.empty()) {
-    double Ta = ekk_instance_.info_.update_count < 10   ? 1e-9
-                : ekk_instance_.info_.update_count < 20 ? 3e-8
-                                                        : 1e-6;
-    HighsInt move_out = workDelta < 0 ? -1 : 1;
-    set<HighsInt>::iterator sit;
-    for (sit = freeList.begin(); sit != freeList.end(); sit++) {
-      HighsInt iCol = *sit;
-      assert(iCol < ekk_instance_.lp_.num_col_);
-      double alpha = ekk_instance_.lp_.a_matrix_.computeDot(*row_ep, iCol);
-      if (fabs(alpha) > Ta) {
-        if (alpha * move_out > 0)
-          ekk_instance_.basis_.nonbasicMove_[iCol] = 1;
-        else
-          ekk_instance_.basis_.nonbasicMove_[iCol] = -1;
+  if (freeList.empty()) return;
+  const double Ta =
+      chuzcSmallEntryTolerance(ekk_instance_.info_.update_count);
+  HighsInt move_out = workDelta < 0 ? -1 : 1;
+  // Accumulate the pivotal row entry of every free column in one pass
+  // over row_ep, scattering through the row-wise structure of the
+  // free columns: this fuses the per-column dot products, so the cost
+  // is the free columns' nonzeros in row_ep's pattern rather than all
+  // of their nonzeros for each of them. Entries of columns removed
+  // from the Freelist since it was built are skipped via the position
+  // map
+  freeAlpha.assign(freeList.size(), 0.0);
+  const HighsInt num_row = ekk_instance_.lp_.num_row_;
+  if (row_ep->count >= 0) {
+    for (HighsInt ix = 0; ix < row_ep->count; ix++) {
+      const HighsInt iRow = row_ep->index[ix];
+      const double multiplier = row_ep->array[iRow];
+      for (HighsInt k = freeRowStart[iRow]; k < freeRowStart[iRow + 1]; k++) {
+        const HighsInt pos = freeListPos[freeRowCol[k]];
+        if (pos >= 0) freeAlpha[pos] += multiplier * freeRowValue[k];
       }
     }
+  } else {
+    // Indices of row_ep are not maintained, so scan it densely
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const double multiplier = row_ep->array[iRow];
+      if (!multiplier) continue;
+      for (HighsInt k = freeRowStart[iRow]; k < freeRowStart[iRow + 1]; k++) {
+        const HighsInt pos = freeListPos[freeRowCol[k]];
+        if (pos >= 0) freeAlpha[pos] += multiplier * freeRowValue[k];
+      }
+    }
+  }
+  for (HighsInt pos = 0; pos < (HighsInt)freeList.size(); pos++) {
+    const double alpha = freeAlpha[pos];
+    if (fabs(alpha) > Ta) {
+      const HighsInt iCol = freeList[pos];
+      if (alpha * move_out > 0)
+        ekk_instance_.basis_.nonbasicMove_[iCol] = 1;
+      else
+        ekk_instance_.basis_.nonbasicMove_[iCol] = -1;
+    }
   }
 }
 void HEkkDualRow::deleteFreemove() {
   if (!freeList.empty()) {
-    set<HighsInt>::iterator sit;
-    for (sit = freeList.begin(); sit != freeList.end(); sit++) {
-      HighsInt iCol = *sit;
+    for (HighsInt iCol : freeList) {
       assert(iCol < ekk_instance_.lp_.num_col_);
       ekk_instance_.basis_.nonbasicMove_[iCol] = 0;
     }
@@ -624,9 +772,16 @@ void HEkkDualRow::deleteFreemove() {
 }
 
 void HEkkDualRow::deleteFreelist(HighsInt iColumn) {
-  if (!freeList.empty()) {
-    if (freeList.count(iColumn)) freeList.erase(iColumn);
-  }
+  if (freeList.empty()) return;
+  const HighsInt pos = freeListPos[iColumn];
+  if (pos < 0) return;
+  // Swap-remove: move the last entry into the vacated slot and fix up
+  // its position
+  const HighsInt last_col = freeList.back();
+  freeList[pos] = last_col;
+  freeListPos[last_col] = pos;
+  freeList.pop_back();
+  freeListPos[iColumn] = -1;
 }
 
 void HEkkDualRow::computeDevexWeight(const HighsInt slice) {
@@ -649,14 +804,6 @@ void HEkkDualRow::computeDevexWeight(const HighsInt slice) {
   }
 }
 
-HighsInt HEkkDualRow::debugFindInWorkData(
-    const HighsInt iCol, const HighsInt count,
-    const std::vector<std::pair<HighsInt, double>>& workData_) {
-  for (HighsInt Ix = 0; Ix < count; Ix++)
-    if (workData_[Ix].first == iCol) return Ix;
-  return -1;
-}
-
 HighsInt HEkkDualRow::debugChooseColumnInfeasibilities() const {
   HighsInt num_infeasibility = 0;
   if (ekk_instance_.options_->highs_debug_level < kHighsDebugLevelCheap)
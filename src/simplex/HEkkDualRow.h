@@ -16,7 +16,6 @@
 #ifndef SIMPLEX_HEKKDUALROW_H_
 #define SIMPLEX_HEKKDUALROW_H_
 
-#include <set>
 #include <vector>
 
 #include "simplex/HEkk.h"
@@ -147,9 +146,6 @@ class HEkkDualRow {
    */
   void computeDevexWeight(const HighsInt slice = -1);
 
-  HighsInt debugFindInWorkData(
-      const HighsInt iCol, const HighsInt count,
-      const std::vector<std::pair<HighsInt, double>>& workData_);
   HighsInt debugChooseColumnInfeasibilities() const;
   void debugReportBfrtVar(
       const HighsInt ix,
@@ -171,8 +167,20 @@ class HEkkDualRow {
       nullptr;  //!< Pointer to
                 //!< ekk_instance_.info_.devex_index_;
 
-  // Freelist:
-  std::set<HighsInt> freeList;  //!< Freelist itself
+  // Freelist: dense list of the nonbasic free columns, with a
+  // position map so membership tests and removal are O(1) and the
+  // per-pivot Freemove loops scan contiguous memory
+  std::vector<HighsInt> freeList;     //!< Freelist itself
+  std::vector<HighsInt> freeListPos;  //!< Position of each column in
+                                      //!< freeList, or -1 if absent
+  // Row-wise structure of the free columns' nonzeros, built by
+  // createFreelist so that createFreemove can scan the pattern of
+  // row_ep once rather than forming a dot product per free column
+  std::vector<HighsInt> freeRowStart;
+  std::vector<HighsInt> freeRowCol;
+  std::vector<double> freeRowValue;
+  std::vector<double> freeAlpha;  //!< Workspace: pivotal row entry of
+                                  //!< each free column
 
   // packed data:
   HighsInt packCount = 0;           //!< number of packed indices/values
@@ -191,13 +199,24 @@ class HEkkDualRow {
 
   std::vector<std::pair<HighsInt, double>>
       workData;  //!< Index-Value pairs for ratio test
+  std::vector<double>
+      workTight;  //!< workMove[iCol]*workDual[iCol] for each workData
+                  //!< entry, cached so the multi-pass BFRT loops avoid
+                  //!< re-gathering at scattered columns
+  std::vector<double>
+      workRangeCand;  //!< workRange[iCol] for each workData entry,
+                      //!< cached and reordered in lockstep likewise
   std::vector<HighsInt>
       workGroup;  //!< Pointers into workData for degenerate nodes in BFRT
 
-  // Independent identifiers for heap-based sort in BFRT
+  // Independent identifiers for heap-based sort in BFRT, which reads
+  // workData in place rather than from a copy. Both vectors are sized
+  // once in setupSlice, with alt_workCount (and the ratio count local
+  // to chooseFinalWorkGroupHeap) tracking the logical sizes, so the
+  // hot path never reallocates
   HighsInt alt_workCount = 0;
-  std::vector<std::pair<HighsInt, double>> original_workData;
   std::vector<std::pair<HighsInt, double>> sorted_workData;
+  std::vector<std::pair<double, HighsInt>> heap_ratio;
   std::vector<HighsInt> alt_workGroup;
 
   HighsSimplexAnalysis* analysis = nullptr;
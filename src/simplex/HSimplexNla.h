@@ -32,6 +32,7 @@ struct ProductFormUpdate {
   HighsInt update_count_;
   vector<HighsInt> pivot_index_;
   vector<double> pivot_value_;
+  vector<double> inv_pivot_value_;
   vector<HighsInt> start_;
   vector<HighsInt> index_;
   vector<double> value_;
@@ -121,19 +122,19 @@ class HSimplexNla {
                const HighsSparseMatrix* scaled_ar_matrix);
   bool sparseLoopStyle(const HighsInt count, const HighsInt dim,
                        HighsInt& to_entry) const;
-  void reportVector(const std::string message, const HighsInt num_index,
-                    const vector<double> vector_value,
-                    const vector<HighsInt> vector_index,
+  void reportVector(const std::string& message, const HighsInt num_index,
+                    const vector<double>& vector_value,
+                    const vector<HighsInt>& vector_index,
                     const bool force) const;
-  void reportArray(const std::string message, const HVector* vector,
+  void reportArray(const std::string& message, const HVector* vector,
                    const bool force = false) const;
-  void reportArray(const std::string message, const HighsInt offset,
+  void reportArray(const std::string& message, const HighsInt offset,
                    const HVector* vector, const bool force = false) const;
-  void reportArraySparse(const std::string message, const HVector* vector,
+  void reportArraySparse(const std::string& message, const HVector* vector,
                          const bool force = false) const;
-  void reportArraySparse(const std::string message, const HighsInt offset,
+  void reportArraySparse(const std::string& message, const HighsInt offset,
                          const HVector* vector, const bool force = false) const;
-  void reportPackValue(const std::string message, const HVector* vector,
+  void reportPackValue(const std::string& message, const HVector* vector,
                        const bool force = false) const;
   // Debug methods
   HighsDebugStatus debugCheckData(const std::string message = "") const;
@@ -16,9 +16,15 @@
  */
 #include "simplex/HSimplexNla.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 // #include <stdio.h>
 #include <algorithm>
 
+#include "pdqsort/pdqsort.h"
+
 using std::fabs;
 const HighsInt kProductFormExtraEntries = 1000;
 const HighsInt kProductFormMaxUpdates = 50;
@@ -30,6 +36,7 @@ void ProductFormUpdate::clear() {
   update_count_ = 0;
   pivot_index_.clear();
   pivot_value_.clear();
+  inv_pivot_value_.clear();
   start_.clear();
   index_.clear();
   value_.clear();
@@ -40,6 +47,12 @@ void ProductFormUpdate::setup(const HighsInt num_row,
   valid_ = true;
   num_row_ = num_row;
   update_count_ = 0;
+  // Reserve for the update limit so the per-update appends never
+  // reallocate
+  pivot_index_.reserve(kProductFormMaxUpdates);
+  pivot_value_.reserve(kProductFormMaxUpdates);
+  inv_pivot_value_.reserve(kProductFormMaxUpdates);
+  start_.reserve(kProductFormMaxUpdates + 1);
   start_.push_back(0);
   HighsInt reserve_entry_space =
       kProductFormExtraEntries +
@@ -57,11 +70,24 @@ HighsInt ProductFormUpdate::update(HVector* aq, HighsInt* pivot_row) {
     return kRebuildReasonPossiblySingularBasis;
   pivot_index_.push_back(*pivot_row);
   pivot_value_.push_back(pivot);
+  // Cache the reciprocal so the once-per-application division in
+  // ftran and btran becomes a multiply
+  inv_pivot_value_.push_back(1.0 / pivot);
+  // Store the eta entries in increasing row order: aq's pattern is
+  // unordered, and each eta is re-applied in every subsequent
+  // ftran/btran until the next re-inversion, so one sort here buys
+  // monotone rhs access in all of those applications
+  std::vector<std::pair<HighsInt, double>> entries;
+  entries.reserve(aq->count);
   for (HighsInt iX = 0; iX < aq->count; iX++) {
     HighsInt iRow = aq->index[iX];
     if (iRow == *pivot_row) continue;
-    index_.push_back(iRow);
-    value_.push_back(aq->array[iRow]);
+    entries.push_back(std::make_pair(iRow, aq->array[iRow]));
+  }
+  pdqsort(entries.begin(), entries.end());
+  for (size_t iX = 0; iX < entries.size(); iX++) {
+    index_.push_back(entries[iX].first);
+    value_.push_back(entries[iX].second);
   }
   start_.push_back(index_.size());
   update_count_++;
@@ -75,9 +101,33 @@ void ProductFormUpdate::btran(HVector& rhs) const {
   for (HighsInt iX = update_count_ - 1; iX >= 0; iX--) {
     const HighsInt pivot_index = pivot_index_[iX];
     double pivot_value = rhs.array[pivot_index];
-    for (HighsInt iEl = start_[iX]; iEl < start_[iX + 1]; iEl++)
+    const HighsInt to_el = start_[iX + 1];
+    HighsInt iEl = start_[iX];
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+    // The eta application in BTRAN is a sparse dot product against
+    // the dense rhs, so gather four rhs entries per step and reduce
+    // the accumulated products once at the end. FTRAN gets no such
+    // kernel: its eta application scatters into rhs while
+    // maintaining the fill-in index list, which is inherently scalar
+    __m256d prod_v = _mm256_setzero_pd();
+    const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+    for (; iEl + 4 <= to_el; iEl += 4) {
+      const __m128i idx =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&index_[iEl]));
+      prod_v = _mm256_add_pd(
+          prod_v,
+          _mm256_mul_pd(_mm256_loadu_pd(&value_[iEl]),
+                        _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                                 rhs.array.data(), idx,
+                                                 all_lanes, 8)));
+    }
+    alignas(32) double prod_s[4];
+    _mm256_store_pd(prod_s, prod_v);
+    pivot_value -= prod_s[0] + prod_s[1] + prod_s[2] + prod_s[3];
+#endif
+    for (; iEl < to_el; iEl++)
       pivot_value -= value_[iEl] * rhs.array[index_[iEl]];
-    pivot_value /= pivot_value_[iX];
+    pivot_value *= inv_pivot_value_[iX];
     if (rhs.array[pivot_index] == 0) rhs.index[rhs.count++] = pivot_index;
     rhs.array[pivot_index] =
         (fabs(pivot_value) < kHighsTiny) ? 1e-100 : pivot_value;
@@ -100,7 +150,7 @@ void ProductFormUpdate::ftran(HVector& rhs) const {
     double pivot_value = rhs.array[pivot_index];
     if (fabs(pivot_value) > kHighsTiny) {
       assert(in_index[pivot_index]);
-      pivot_value /= pivot_value_[iX];
+      pivot_value *= inv_pivot_value_[iX];
       rhs.array[pivot_index] = pivot_value;
       for (HighsInt iEl = start_[iX]; iEl < start_[iX + 1]; iEl++) {
         HighsInt iRow = index_[iEl];
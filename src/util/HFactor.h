@@ -446,10 +446,10 @@ class HFactor {
   // Action to take when pointers to the A matrix are no longer valid
   void invalidAMatrixAction();
 
-  void reportIntVector(const std::string name,
-                       const vector<HighsInt> entry) const;
-  void reportDoubleVector(const std::string name,
-                          const vector<double> entry) const;
+  void reportIntVector(const std::string& name,
+                       const vector<HighsInt>& entry) const;
+  void reportDoubleVector(const std::string& name,
+                          const vector<double>& entry) const;
 
   void ftranL(HVector& vector, const double expected_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
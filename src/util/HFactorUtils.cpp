@@ -78,29 +78,43 @@ void HFactor::reportLu(const HighsInt l_u_or_both, const bool full) const {
   }
 }
 
-void HFactor::reportIntVector(const std::string name,
-                              const vector<HighsInt> entry) const {
+// Format whole vectors into one buffer and write them with a single
+// stdio call, rather than one locked printf per entry
+void HFactor::reportIntVector(const std::string& name,
+                              const vector<HighsInt>& entry) const {
   const HighsInt num_en = entry.size();
-  printf("%-12s: siz %4d; cap %4d: ", name.c_str(), (int)num_en,
-         (int)entry.capacity());
+  char field[64];
+  std::string buffer;
+  buffer.reserve(12 * num_en + 64);
+  snprintf(field, sizeof(field), "%-12s: siz %4d; cap %4d: ", name.c_str(),
+           (int)num_en, (int)entry.capacity());
+  buffer += field;
   for (HighsInt iEn = 0; iEn < num_en; iEn++) {
     if (iEn > 0 && iEn % 10 == 0)
-      printf("\n                                  ");
-    printf("%11d ", (int)entry[iEn]);
+      buffer += "\n                                  ";
+    snprintf(field, sizeof(field), "%11d ", (int)entry[iEn]);
+    buffer += field;
   }
-  printf("\n");
+  buffer += "\n";
+  fputs(buffer.c_str(), stdout);
 }
-void HFactor::reportDoubleVector(const std::string name,
-                                 const vector<double> entry) const {
+void HFactor::reportDoubleVector(const std::string& name,
+                                 const vector<double>& entry) const {
   const HighsInt num_en = entry.size();
-  printf("%-12s: siz %4d; cap %4d: ", name.c_str(), (int)num_en,
-         (int)entry.capacity());
+  char field[64];
+  std::string buffer;
+  buffer.reserve(12 * num_en + 64);
+  snprintf(field, sizeof(field), "%-12s: siz %4d; cap %4d: ", name.c_str(),
+           (int)num_en, (int)entry.capacity());
+  buffer += field;
   for (HighsInt iEn = 0; iEn < num_en; iEn++) {
     if (iEn > 0 && iEn % 10 == 0)
-      printf("\n                                  ");
-    printf("%11.4g ", entry[iEn]);
+      buffer += "\n                                  ";
+    snprintf(field, sizeof(field), "%11.4g ", entry[iEn]);
+    buffer += field;
   }
-  printf("\n");
+  buffer += "\n";
+  fputs(buffer.c_str(), stdout);
 }
 
 void HFactor::reportAsm() {
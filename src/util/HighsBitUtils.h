@@ -0,0 +1,42 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsBitUtils.h
+ * @brief Portable popcount and count-trailing-zeros for SIMD mask loops
+ *
+ * MSVC defines __AVX2__ under /arch:AVX2 but has no __builtin_*
+ * intrinsics, so the mask loops route these operations through the
+ * compiler-appropriate form, as HighsHash.h does for its bit scans.
+ */
+#ifndef UTIL_HIGHS_BIT_UTILS_H_
+#define UTIL_HIGHS_BIT_UTILS_H_
+
+#ifdef _MSC_VER
+#include <intrin.h>
+
+inline int highsPopcount32(unsigned x) { return (int)__popcnt(x); }
+
+// precondition: x != 0
+inline int highsCtz32(unsigned x) {
+  unsigned long result;
+  _BitScanForward(&result, x);
+  return (int)result;
+}
+#else
+
+inline int highsPopcount32(unsigned x) { return __builtin_popcount(x); }
+
+// precondition: x != 0
+inline int highsCtz32(unsigned x) { return __builtin_ctz(x); }
+#endif
+
+#endif /* UTIL_HIGHS_BIT_UTILS_H_ */
@@ -22,8 +22,13 @@
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsSparseVectorSum.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 using std::fabs;
 using std::max;
 using std::min;
@@ -700,9 +705,31 @@ bool HighsSparseMatrix::hasLargeValue(const double large_matrix_value) {
   return false;
 }
 
+// Largest magnitude in value[0..count), the per-vector reduction of
+// the consider*Scaling passes. On AVX2 builds the sign bits of four
+// entries are cleared per iteration and the running maximum kept in a
+// vector register that is reduced at the end.
+static double maxAbsValue(const double* value, const HighsInt count) {
+  HighsInt k = 0;
+  double max_value = 0;
+#if defined(__AVX2__)
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+  __m256d vmax = _mm256_setzero_pd();
+  for (; k + 4 <= count; k += 4)
+    vmax = _mm256_max_pd(vmax,
+                         _mm256_and_pd(_mm256_loadu_pd(&value[k]), abs_mask));
+  __m128d max128 = _mm_max_pd(_mm256_castpd256_pd128(vmax),
+                              _mm256_extractf128_pd(vmax, 1));
+  max128 = _mm_max_sd(max128, _mm_unpackhi_pd(max128, max128));
+  max_value = _mm_cvtsd_f64(max128);
+#endif
+  for (; k < count; k++) max_value = max(fabs(value[k]), max_value);
+  return max_value;
+}
+
 void HighsSparseMatrix::considerColScaling(
     const HighsInt max_scale_factor_exponent, double* col_scale) {
-  const double log2 = log(2.0);
   const double max_allow_scale = pow(2.0, max_scale_factor_exponent);
   const double min_allow_scale = 1 / max_allow_scale;
 
@@ -711,15 +738,14 @@ void HighsSparseMatrix::considerColScaling(
 
   if (this->isColwise()) {
     for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      double col_max_value = 0;
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        col_max_value = max(fabs(this->value_[iEl]), col_max_value);
+      const HighsInt col_start = this->start_[iCol];
+      const double col_max_value = maxAbsValue(
+          this->value_.data() + col_start, this->start_[iCol + 1] - col_start);
       if (col_max_value) {
         double col_scale_value = 1 / col_max_value;
         // Convert the col scale factor to the nearest power of two, and
         // ensure that it is not excessively large or small
-        col_scale_value = pow(2.0, floor(log(col_scale_value) / log2 + 0.5));
+        col_scale_value = nearestPowerOfTwo(col_scale_value);
         col_scale_value =
             min(max(min_allow_col_scale, col_scale_value), max_allow_col_scale);
         col_scale[iCol] = col_scale_value;
@@ -739,7 +765,6 @@ void HighsSparseMatrix::considerColScaling(
 
 void HighsSparseMatrix::considerRowScaling(
     const HighsInt max_scale_factor_exponent, double* row_scale) {
-  const double log2 = log(2.0);
   const double max_allow_scale = pow(2.0, max_scale_factor_exponent);
   const double min_allow_scale = 1 / max_allow_scale;
 
@@ -748,15 +773,14 @@ void HighsSparseMatrix::considerRowScaling(
 
   if (this->isRowwise()) {
     for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      double row_max_value = 0;
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++)
-        row_max_value = max(fabs(this->value_[iEl]), row_max_value);
+      const HighsInt row_start = this->start_[iRow];
+      const double row_max_value = maxAbsValue(
+          this->value_.data() + row_start, this->start_[iRow + 1] - row_start);
       if (row_max_value) {
         double row_scale_value = 1 / row_max_value;
         // Convert the row scale factor to the nearest power of two, and
         // ensure that it is not excessively large or small
-        row_scale_value = pow(2.0, floor(log(row_scale_value) / log2 + 0.5));
+        row_scale_value = nearestPowerOfTwo(row_scale_value);
         row_scale_value =
             min(max(min_allow_row_scale, row_scale_value), max_allow_row_scale);
         row_scale[iRow] = row_scale_value;
@@ -787,7 +811,12 @@ void HighsSparseMatrix::scaleCol(const HighsInt col, const double colScale) {
     for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
       for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
            iEl++) {
-        if (this->index_[iEl] == col) this->value_[iEl] *= colScale;
+        // A legal matrix holds col at most once per row, so stop
+        // scanning this row on a match
+        if (this->index_[iEl] == col) {
+          this->value_[iEl] *= colScale;
+          break;
+        }
       }
     }
   }
@@ -803,7 +832,12 @@ void HighsSparseMatrix::scaleRow(const HighsInt row, const double rowScale) {
     for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
       for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
            iEl++) {
-        if (this->index_[iEl] == row) this->value_[iEl] *= rowScale;
+        // A legal matrix holds row at most once per column, so stop
+        // scanning this column on a match
+        if (this->index_[iEl] == row) {
+          this->value_[iEl] *= rowScale;
+          break;
+        }
       }
     }
   } else {
@@ -812,23 +846,102 @@ void HighsSparseMatrix::scaleRow(const HighsInt row, const double rowScale) {
   }
 }
 
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+// Scale value[0..count) by uniform_scale * gather_scale[index[k]], the
+// inner kernel of applyScale and the mixed apply{Col,Row}Scale loops.
+// The indirect scale loads are issued as hardware gathers, eight per
+// iteration on AVX-512 and four on AVX2, with a scalar tail.
+static inline void scaleValuesGather(double* value, const HighsInt* index,
+                                     const HighsInt count,
+                                     const double uniform_scale,
+                                     const double* gather_scale) {
+  HighsInt k = 0;
+#if defined(__AVX512F__)
+  const __m512d uniform8 = _mm512_set1_pd(uniform_scale);
+  for (; k + 8 <= count; k += 8) {
+    __m256i idx = _mm256_loadu_si256((const __m256i*)&index[k]);
+    // the masked gather form with a zeroed source: same instruction,
+    // but avoids the maybe-uninitialized pass-through operand the
+    // unmasked form expands to
+    __m512d gathered = _mm512_mask_i32gather_pd(_mm512_setzero_pd(),
+                                                (__mmask8)0xff, idx,
+                                                gather_scale, 8);
+    __m512d v = _mm512_loadu_pd(&value[k]);
+    _mm512_storeu_pd(&value[k],
+                     _mm512_mul_pd(v, _mm512_mul_pd(uniform8, gathered)));
+  }
+#else
+  const __m256d uniform4 = _mm256_set1_pd(uniform_scale);
+  const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+  for (; k + 4 <= count; k += 4) {
+    __m128i idx = _mm_loadu_si128((const __m128i*)&index[k]);
+    __m256d gathered = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                                gather_scale, idx, all_lanes, 8);
+    __m256d v = _mm256_loadu_pd(&value[k]);
+    _mm256_storeu_pd(&value[k],
+                     _mm256_mul_pd(v, _mm256_mul_pd(uniform4, gathered)));
+  }
+#endif
+  for (; k < count; k++) value[k] *= uniform_scale * gather_scale[index[k]];
+}
+#else
+static inline void scaleValuesGather(double* value, const HighsInt* index,
+                                     const HighsInt count,
+                                     const double uniform_scale,
+                                     const double* gather_scale) {
+  for (HighsInt k = 0; k < count; k++)
+    value[k] *= uniform_scale * gather_scale[index[k]];
+}
+#endif
+
+// Minimum number of nonzeros before applyScale partitions its outer
+// loop across the task scheduler: below this the pass is too short to
+// amortize task dispatch
+const HighsInt kApplyScaleParallelMinNz = 65536;
+
 void HighsSparseMatrix::applyScale(const HighsScale& scale) {
   assert(this->formatOk());
+  // Note that the indirect scale-factor loads cannot usefully be
+  // cache-blocked by row range: nothing guarantees the index_ entries
+  // of a vector are sorted, so restricting each sweep to a row window
+  // would re-read every nonzero once per window instead of once
+  //
+  // Vector ranges are partitioned by outer index, so no two tasks write
+  // the same value_ entries. Only worker threads of an initialized
+  // scheduler may spawn tasks, hence the deque test; otherwise (or for
+  // small matrices) the pass runs serially.
+  const bool parallel =
+      this->numNz() >= kApplyScaleParallelMinNz &&
+      HighsTaskExecutor::getThisWorkerDeque() != nullptr;
   if (this->isColwise()) {
-    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++) {
-        HighsInt iRow = this->index_[iEl];
-        this->value_[iEl] *= (scale.col[iCol] * scale.row[iRow]);
+    auto scaleCols = [&](HighsInt from_col, HighsInt to_col) {
+      for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+        const HighsInt start = this->start_[iCol];
+        scaleValuesGather(this->value_.data() + start,
+                          this->index_.data() + start,
+                          this->start_[iCol + 1] - start, scale.col[iCol],
+                          scale.row.data());
       }
+    };
+    if (parallel) {
+      highs::parallel::for_each(0, this->num_col_, scaleCols, 4096);
+    } else {
+      scaleCols(0, this->num_col_);
     }
   } else {
-    for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++) {
-        HighsInt iCol = this->index_[iEl];
-        this->value_[iEl] *= (scale.col[iCol] * scale.row[iRow]);
+    auto scaleRows = [&](HighsInt from_row, HighsInt to_row) {
+      for (HighsInt iRow = from_row; iRow < to_row; iRow++) {
+        const HighsInt start = this->start_[iRow];
+        scaleValuesGather(this->value_.data() + start,
+                          this->index_.data() + start,
+                          this->start_[iRow + 1] - start, scale.row[iRow],
+                          scale.col.data());
       }
+    };
+    if (parallel) {
+      highs::parallel::for_each(0, this->num_row_, scaleRows, 4096);
+    } else {
+      scaleRows(0, this->num_row_);
     }
   }
 }
@@ -843,9 +956,10 @@ void HighsSparseMatrix::applyColScale(const HighsScale& scale) {
     }
   } else {
     for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++)
-        this->value_[iEl] *= scale.col[this->index_[iEl]];
+      const HighsInt start = this->start_[iRow];
+      scaleValuesGather(this->value_.data() + start,
+                        this->index_.data() + start,
+                        this->start_[iRow + 1] - start, 1.0, scale.col.data());
     }
   }
 }
@@ -854,9 +968,10 @@ void HighsSparseMatrix::applyRowScale(const HighsScale& scale) {
   assert(this->formatOk());
   if (this->isColwise()) {
     for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        this->value_[iEl] *= scale.row[this->index_[iEl]];
+      const HighsInt start = this->start_[iCol];
+      scaleValuesGather(this->value_.data() + start,
+                        this->index_.data() + start,
+                        this->start_[iCol + 1] - start, 1.0, scale.row.data());
     }
   } else {
     for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
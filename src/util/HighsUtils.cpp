@@ -17,12 +17,18 @@
 #include "util/HighsUtils.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdio>
 #include <vector>
 
+#include "util/HighsBitUtils.h"
 #include "util/HighsSort.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 bool create(HighsIndexCollection& index_collection, const HighsInt from_col,
             const HighsInt to_col, const HighsInt dimension) {
   if (from_col < 0) return false;
@@ -171,20 +177,39 @@ bool ok(const HighsIndexCollection& index_collection) {
   return true;
 }
 
-void limits(const HighsIndexCollection& index_collection, HighsInt& from_k,
-            HighsInt& to_k) {
-  if (index_collection.is_interval_) {
-    from_k = index_collection.from_;
-    to_k = index_collection.to_;
-  } else if (index_collection.is_set_) {
-    from_k = 0;
-    to_k = index_collection.set_num_entries_ - 1;
-  } else if (index_collection.is_mask_) {
-    from_k = 0;
-    to_k = index_collection.dimension_ - 1;
-  } else {
-    assert(1 == 0);
+// Returns the first index in [from, dim) whose mask entry is nonzero
+// (find_nonzero true) or zero (find_nonzero false), or dim if there is
+// none: the run-boundary scan of mask-kind collections. On AVX-512 and
+// AVX2 builds the mask entries are compared sixteen or eight at a time
+// and the first differing lane located with a count of trailing zeros.
+static HighsInt findMaskTransition(const std::vector<HighsInt>& mask,
+                                   const HighsInt from, const HighsInt dim,
+                                   const bool find_nonzero) {
+  HighsInt ix = from;
+#if defined(__AVX2__) && !defined(HIGHSINT64)
+#if defined(__AVX512F__)
+  const __m512i zero16 = _mm512_setzero_si512();
+  for (; ix + 16 <= dim; ix += 16) {
+    __m512i entries = _mm512_loadu_si512((const void*)&mask[ix]);
+    uint32_t lanes = find_nonzero
+                         ? _mm512_cmpneq_epi32_mask(entries, zero16)
+                         : _mm512_cmpeq_epi32_mask(entries, zero16);
+    if (lanes) return ix + highsCtz32(lanes);
   }
+#else
+  const __m256i zero8 = _mm256_setzero_si256();
+  for (; ix + 8 <= dim; ix += 8) {
+    __m256i entries = _mm256_loadu_si256((const __m256i*)&mask[ix]);
+    uint32_t lanes = (uint32_t)_mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(entries, zero8)));
+    if (find_nonzero) lanes = ~lanes & 0xffu;
+    if (lanes) return ix + highsCtz32(lanes);
+  }
+#endif
+#endif
+  for (; ix < dim; ix++)
+    if ((mask[ix] != 0) == find_nonzero) return ix;
+  return dim;
 }
 
 void updateOutInIndex(const HighsIndexCollection& index_collection,
@@ -216,22 +241,20 @@ void updateOutInIndex(const HighsIndexCollection& index_collection,
       in_to_ix = index_collection.dimension_ - 1;
     }
   } else {
+    const HighsInt dimension = index_collection.dimension_;
     out_from_ix = in_to_ix + 1;
-    out_to_ix = index_collection.dimension_ - 1;
-    for (HighsInt ix = in_to_ix + 1; ix < index_collection.dimension_; ix++) {
-      if (!index_collection.mask_[ix]) {
-        out_to_ix = ix - 1;
-        break;
-      }
-    }
+    // The run of mask entries to delete ends before the next zero
+    // entry (or the end of the mask), and the kept run before the next
+    // nonzero entry after that
+    HighsInt next_zero =
+        findMaskTransition(index_collection.mask_, out_from_ix, dimension,
+                           false);
+    out_to_ix = next_zero >= dimension ? dimension - 1 : next_zero - 1;
     in_from_ix = out_to_ix + 1;
-    in_to_ix = index_collection.dimension_ - 1;
-    for (HighsInt ix = out_to_ix + 1; ix < index_collection.dimension_; ix++) {
-      if (index_collection.mask_[ix]) {
-        in_to_ix = ix - 1;
-        break;
-      }
-    }
+    HighsInt next_nonzero =
+        findMaskTransition(index_collection.mask_, in_from_ix, dimension,
+                           true);
+    in_to_ix = next_nonzero >= dimension ? dimension - 1 : next_nonzero - 1;
   }
 }
 
@@ -291,11 +314,6 @@ double getNorm2(const std::vector<double> values) {
   return sum;
 }
 
-bool highs_isInfinity(double val) {
-  if (val >= kHighsInf) return true;
-  return false;
-}
-
 double highsRelativeDifference(const double v0, const double v1) {
   return fabs(v0 - v1) / std::max(v0, std::max(v1, 1.0));
 }
@@ -304,22 +322,38 @@ void analyseVectorValues(const HighsLogOptions* log_options,
                          const std::string message, HighsInt vecDim,
                          const std::vector<double>& vec, bool analyseValueList,
                          std::string model_name) {
+  analyseVectorValues(
+      log_options, message, vecDim,
+      [&vec](HighsInt ix) { return vec[ix]; }, analyseValueList, model_name);
+}
+
+void analyseVectorValues(const HighsLogOptions* log_options,
+                         const std::string message, HighsInt vecDim,
+                         const std::function<double(HighsInt)>& getValue,
+                         bool analyseValueList, std::string model_name) {
   if (vecDim == 0) return;
-  double log10 = log(10.0);
   const HighsInt nVK = 20;
+  // Powers of ten spanning the bucket range, pow10_table[i] =
+  // 10^(i - nVK - 1), so each entry's bucket comes from its binary
+  // exponent and at most two table compares rather than a libm log
+  // call per entry
+  static const std::vector<double> pow10_table = [] {
+    std::vector<double> table(2 * nVK + 3);
+    for (size_t i = 0; i < table.size(); i++)
+      table[i] = std::pow(10.0, (double)i - (nVK + 1));
+    return table;
+  }();
   HighsInt nNz = 0;
   HighsInt nPosInfV = 0;
   HighsInt nNegInfV = 0;
-  std::vector<HighsInt> posVK;
-  std::vector<HighsInt> negVK;
-  posVK.resize(nVK + 1, 0);
-  negVK.resize(nVK + 1, 0);
+  // The counting arrays have compile-time sizes, so keep them off the
+  // heap
+  std::array<HighsInt, nVK + 1> posVK{};
+  std::array<HighsInt, nVK + 1> negVK{};
 
   const HighsInt VLsMxZ = 10;
-  std::vector<HighsInt> VLsK;
-  std::vector<double> VLsV;
-  VLsK.resize(VLsMxZ, 0);
-  VLsV.resize(VLsMxZ, 0);
+  std::array<HighsInt, VLsMxZ> VLsK{};
+  std::array<double, VLsMxZ> VLsV{};
   // Ensure that 1.0 and -1.0 are counted
   const HighsInt PlusOneIx = 0;
   const HighsInt MinusOneIx = 1;
@@ -330,7 +364,7 @@ void analyseVectorValues(const HighsLogOptions* log_options,
   double min_abs_value = kHighsInf;
   double max_abs_value = 0;
   for (HighsInt ix = 0; ix < vecDim; ix++) {
-    double v = vec[ix];
+    double v = getValue(ix);
     double absV = std::fabs(v);
     if (absV) {
       min_abs_value = std::min(absV, min_abs_value);
@@ -347,17 +381,24 @@ void analyseVectorValues(const HighsLogOptions* log_options,
         //+Inf value
         nPosInfV++;
       } else {
-        // Finite nonzero value
-        if (absV == 1) {
-          log10V = 0;
-        } else if (absV == 10) {
-          log10V = 1;
-        } else if (absV == 100) {
-          log10V = 2;
-        } else if (absV == 1000) {
-          log10V = 3;
+        // Finite nonzero value: bucket by the base-10 logarithm,
+        // truncated towards zero, without a transcendental call
+        if (absV >= 1e20) {
+          log10V = nVK;
+        } else if (absV < 1e-20) {
+          log10V = -nVK;
         } else {
-          log10V = log(absV) / log10;
+          // floor(log10(2) * binary exponent) is within one of
+          // floor(log10(absV)); settle it against the table
+          HighsInt floor10 =
+              (HighsInt)std::floor(std::ilogb(absV) * 0.3010299956639812);
+          while (absV < pow10_table[floor10 + nVK + 1]) floor10--;
+          while (absV >= pow10_table[floor10 + nVK + 2]) floor10++;
+          // Truncation towards zero only differs from the floor for
+          // non-powers of ten below one
+          log10V = (floor10 >= 0 || absV == pow10_table[floor10 + nVK + 1])
+                       ? floor10
+                       : floor10 + 1;
         }
         if (log10V >= 0) {
           HighsInt k = std::min(log10V, nVK);
@@ -17,6 +17,8 @@
 #define UTIL_HIGHSUTILS_H_
 
 #include <cassert>
+#include <cmath>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -95,8 +97,28 @@ void create(HighsIndexCollection& index_collection, const HighsInt* mask,
 
 bool ok(const HighsIndexCollection& index_collection);
 
-void limits(const HighsIndexCollection& index_collection, HighsInt& from_k,
-            HighsInt& to_k);
+// Loop limits of the collection. Inline because every assess/change/
+// delete helper re-derives them on entry, often several times for the
+// same collection within one call chain
+inline void limits(const HighsIndexCollection& index_collection,
+                   HighsInt& from_k, HighsInt& to_k) {
+  // Empty range by default, so a malformed collection yields an empty
+  // loop rather than uninitialized limits when asserts are compiled out
+  from_k = 0;
+  to_k = -1;
+  if (index_collection.is_interval_) {
+    from_k = index_collection.from_;
+    to_k = index_collection.to_;
+  } else if (index_collection.is_set_) {
+    from_k = 0;
+    to_k = index_collection.set_num_entries_ - 1;
+  } else if (index_collection.is_mask_) {
+    from_k = 0;
+    to_k = index_collection.dimension_ - 1;
+  } else {
+    assert(1 == 0);
+  }
+}
 
 void updateOutInIndex(const HighsIndexCollection& index_collection,
                       HighsInt& out_from_ix, HighsInt& out_to_ix,
@@ -105,6 +127,37 @@ void updateOutInIndex(const HighsIndexCollection& index_collection,
 
 HighsInt dataSize(const HighsIndexCollection& index_collection);
 
+// Nearest power of two to x, i.e. 2^floor(log2(x)+0.5), computed from
+// the IEEE-754 exponent via frexp/ldexp rather than log/pow: x = m*2^e
+// with m in [0.5, 1), so the rounded exponent is e-1 when m < 1/sqrt(2)
+// and e otherwise
+inline double nearestPowerOfTwo(const double x) {
+  int e;
+  const double m = std::frexp(x, &e);
+  return std::ldexp(1.0, m < 0.70710678118654752440 ? e - 1 : e);
+}
+
+// Applies f(entry, usr_ix) to every entry selected by the index
+// collection, where entry is the index in the collection's dimension
+// and usr_ix the position of its datum in the caller-supplied arrays.
+// The interval/set/mask dispatch happens once, so each kind runs as a
+// tight loop that inlines f
+template <class F>
+void forEachSelected(const HighsIndexCollection& index_collection, F&& f) {
+  HighsInt from_k;
+  HighsInt to_k;
+  limits(index_collection, from_k, to_k);
+  if (index_collection.is_interval_) {
+    for (HighsInt k = from_k; k <= to_k; k++) f(k, k - from_k);
+  } else if (index_collection.is_mask_) {
+    for (HighsInt k = from_k; k <= to_k; k++)
+      if (index_collection.mask_[k]) f(k, k);
+  } else {
+    for (HighsInt k = from_k; k <= to_k; k++)
+      f(index_collection.set_[k], k);
+  }
+}
+
 bool highsVarTypeUserDataNotNull(const HighsLogOptions& log_options,
                                  const HighsVarType* user_data,
                                  const std::string name);
@@ -118,8 +171,11 @@ double getNorm2(const std::vector<double> values);
 /**
  * @brief Logical check of double being +Infinity
  */
-bool highs_isInfinity(double val  //!< Value being tested against +Infinity
-);
+inline bool highs_isInfinity(
+    double val  //!< Value being tested against +Infinity
+) {
+  return val >= kHighsInf;
+}
 /**
  * @brief Returns the relative difference of two doubles
  */
@@ -142,6 +198,14 @@ void analyseVectorValues(
                    //!< different values in the vector
 );
 
+// Overload taking a value accessor, so derived quantities can be
+// analysed on the fly without materializing a temporary vector
+void analyseVectorValues(const HighsLogOptions* log_options,
+                         const std::string message, HighsInt vecDim,
+                         const std::function<double(HighsInt)>& getValue,
+                         bool analyseValueList = false,
+                         std::string model_name = "Unknown");
+
 void analyseMatrixSparsity(
     const HighsLogOptions& log_options,
     const char* message,                  //!< Message to be printed